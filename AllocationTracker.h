@@ -0,0 +1,243 @@
+/** @file       AllocationTracker.h
+ *  @details    Opt-in allocation counters for the containers of the repo.
+ *              When CONTAINER_ALLOCATION_TRACKING is defined, every Array and List instance counts
+ *              the allocations, frees and bytes it causes, and the same events are summed globally.
+ *              Without the macro the containers carry no extra member and make no extra call.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *                                  Frees of several blocks can be recorded at once.
+ *
+ *  @note       Define the macro for the whole program, e.g. -DCONTAINER_ALLOCATION_TRACKING,
+ *              as the layout of the containers depends on it.
+ *  @note       Bytes are the requested sizes: sizeof(T) per array element and sizeof(ListNode<T>) per node.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+#include <atomic>
+#include <string>
+#include <sstream>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief   Allocation counters of a container instance, of the whole program or of a scope.
+ */
+struct AllocationStatistics{
+    uint64_t allocations    = 0;    // Number of allocations
+    uint64_t frees          = 0;    // Number of frees
+    uint64_t bytesAllocated = 0;    // Sum of the allocated bytes
+    uint64_t bytesFreed     = 0;    // Sum of the freed bytes
+    size_t bytesLive        = 0;    // Bytes owned at the moment
+    size_t peakBytesLive    = 0;    // Highest value of bytesLive since the construction or the last reset
+
+    std::string ToText() const;     // Single line of key=value pairs
+};
+
+/**
+ * @brief   Formats the counters as a log friendly line.
+ * @return  Text of the form "allocations=... frees=... ...".
+ */
+inline std::string AllocationStatistics::ToText() const
+{
+    std::ostringstream text;
+    text << "allocations="          << allocations
+         << " frees="               << frees
+         << " bytes_allocated="     << bytesAllocated
+         << " bytes_freed="         << bytesFreed
+         << " bytes_live="          << bytesLive
+         << " peak_bytes_live="     << peakBytesLive;
+
+    return text.str();
+}
+
+namespace AllocationTracker {
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+constexpr bool isEnabled = true;
+#else
+constexpr bool isEnabled = false;   // Global counters stay at zero
+#endif
+
+namespace Detail {
+
+struct GlobalCounters{
+    std::atomic<uint64_t> allocations{0}, frees{0}, bytesAllocated{0}, bytesFreed{0};
+    std::atomic<size_t> bytesLive{0}, peakBytesLive{0};
+};
+
+inline GlobalCounters globalCounters;   // Shared by all translation units
+
+} // namespace Detail
+
+/**
+ * @brief   Records an allocation made by any container.
+ * @param   bytes   Allocated bytes.
+ */
+inline void RecordAllocation(const size_t bytes)
+{
+    Detail::GlobalCounters& counters = Detail::globalCounters;
+
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+    const size_t live = counters.bytesLive.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+
+    size_t peak = counters.peakBytesLive.load(std::memory_order_relaxed);
+    while((live > peak) && (counters.peakBytesLive.compare_exchange_weak(peak, live, std::memory_order_relaxed) == false))
+    { /* peak is reloaded by the failed exchange */ }
+}
+
+/**
+ * @brief   Records a free made by any container.
+ * @param   bytes   Freed bytes.
+ * @param   count   Number of freed blocks, e.g. the nodes of a chain released at once.
+ */
+inline void RecordFree(const size_t bytes, const uint64_t count = 1)
+{
+    Detail::GlobalCounters& counters = Detail::globalCounters;
+
+    counters.frees.fetch_add(count, std::memory_order_relaxed);
+    counters.bytesFreed.fetch_add(bytes, std::memory_order_relaxed);
+    counters.bytesLive.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Takes a snapshot of the program wide counters.
+ * @return  Sum of the events of all containers.
+ */
+inline AllocationStatistics GetGlobalStatistics()
+{
+    const Detail::GlobalCounters& counters = Detail::globalCounters;
+    AllocationStatistics statistics;
+
+    statistics.allocations      = counters.allocations.load(std::memory_order_relaxed);
+    statistics.frees            = counters.frees.load(std::memory_order_relaxed);
+    statistics.bytesAllocated   = counters.bytesAllocated.load(std::memory_order_relaxed);
+    statistics.bytesFreed       = counters.bytesFreed.load(std::memory_order_relaxed);
+    statistics.bytesLive        = counters.bytesLive.load(std::memory_order_relaxed);
+    statistics.peakBytesLive    = counters.peakBytesLive.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+/**
+ * @brief   Zeroes the program wide event counters.
+ * @note    Live bytes describe memory still in use, so they are kept. The peak restarts from them.
+ */
+inline void ResetGlobalStatistics()
+{
+    Detail::GlobalCounters& counters = Detail::globalCounters;
+
+    counters.allocations.store(0, std::memory_order_relaxed);
+    counters.frees.store(0, std::memory_order_relaxed);
+    counters.bytesAllocated.store(0, std::memory_order_relaxed);
+    counters.bytesFreed.store(0, std::memory_order_relaxed);
+    counters.peakBytesLive.store(counters.bytesLive.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Measures the program wide events between its construction and GetDelta().
+ * @note    Intended for tests and benchmarks, e.g. to assert that an operation does not allocate.
+ */
+class Scope{
+public:
+    Scope() : start(GetGlobalStatistics())
+    { /* Empty constructor */ }
+
+    AllocationStatistics GetDelta() const;  // Events since the construction, live bytes are the current ones
+
+private:
+    AllocationStatistics start;
+};
+
+/**
+ * @brief   Computes the events since the construction of the scope.
+ * @return  Differences of the event counters. Live and peak bytes are reported as they are now.
+ */
+inline AllocationStatistics Scope::GetDelta() const
+{
+    AllocationStatistics delta = GetGlobalStatistics();
+
+    delta.allocations       -= start.allocations;
+    delta.frees             -= start.frees;
+    delta.bytesAllocated    -= start.bytesAllocated;
+    delta.bytesFreed        -= start.bytesFreed;
+
+    return delta;
+}
+
+} // namespace AllocationTracker
+
+/**
+ * @brief   Allocation counters embedded into a container instance.
+ * @note    The container reports the bytes it owns after each event, so ownership moved
+ *          between instances without an allocation, e.g. by Swap or Concatenate, is reflected too.
+ */
+class AllocationProbe{
+public:
+    void OnAllocate(const size_t bytes, const size_t bytesOwned)    // Called after an allocation
+    {
+        allocations++;
+        bytesAllocated += bytes;
+        OnOwnershipChange(bytesOwned);
+        AllocationTracker::RecordAllocation(bytes);
+    }
+
+    void OnFree(const size_t bytes, const uint64_t count = 1)       // Called after a free of count blocks
+    {
+        frees += count;
+        bytesFreed += bytes;
+        AllocationTracker::RecordFree(bytes, count);
+    }
+
+    void OnOwnershipChange(const size_t bytesOwned)                 // Called when the owned memory grows
+    { peakBytesLive = (bytesOwned > peakBytesLive) ? bytesOwned : peakBytesLive; }
+
+    AllocationStatistics GetStatistics(const size_t bytesOwned) const;
+    void Reset(const size_t bytesOwned);
+
+private:
+    uint64_t allocations    = 0;
+    uint64_t frees          = 0;
+    uint64_t bytesAllocated = 0;
+    uint64_t bytesFreed     = 0;
+    size_t peakBytesLive    = 0;
+};
+
+/**
+ * @brief   Takes a snapshot of the counters of the instance.
+ * @param   bytesOwned  Bytes owned by the container at the moment.
+ * @return  Counters of the instance.
+ */
+inline AllocationStatistics AllocationProbe::GetStatistics(const size_t bytesOwned) const
+{
+    AllocationStatistics statistics;
+
+    statistics.allocations      = allocations;
+    statistics.frees            = frees;
+    statistics.bytesAllocated   = bytesAllocated;
+    statistics.bytesFreed       = bytesFreed;
+    statistics.bytesLive        = bytesOwned;
+    statistics.peakBytesLive    = (bytesOwned > peakBytesLive) ? bytesOwned : peakBytesLive;
+
+    return statistics;
+}
+
+/**
+ * @brief   Zeroes the counters of the instance, the peak restarts from the owned bytes.
+ * @param   bytesOwned  Bytes owned by the container at the moment.
+ */
+inline void AllocationProbe::Reset(const size_t bytesOwned)
+{
+    allocations     = 0;
+    frees           = 0;
+    bytesAllocated  = 0;
+    bytesFreed      = 0;
+    peakBytesLive   = bytesOwned;
+}
+
+#endif  // Prevent recursive inclusion
@@ -12,14 +12,39 @@
  *                                   Initializer list constructor added.
  *                                   Constructor exception mechanism enhanced.
  *              February 25, 2021 -> File documented with doxygen.
+ *              October 18, 2026  -> Recursive inclusion blocker added.
+ *                                   Range constructor added.
+ *                                   Iterator access functions added.
+ *                                   Element allocations routed through AllocateElements and ReleaseElements.
+ *                                   Opt-in allocation tracking added. (CONTAINER_ALLOCATION_TRACKING)
+ *                                   Tracing probe added to failed element accesses. (CONTAINER_TRACING)
+ *                                   Opt-in deferred destruction of large arrays added. (CONTAINER_DEFERRED_RECLAMATION)
+ *                                   Bulk conversion to and from List added. (see ListArrayConversion.h)
+ *                                   PartialSort, NthElement and TopK added, selecting with introselect.
  *
  *  @note       Feel free to contact for questions, bugs or any other thing.
  *  @copyright  No copyright. Code is open source.
  */
 
+#ifndef ARRAY_CONTAINER_H
+#define ARRAY_CONTAINER_H
+
 #include <iostream>
 #include <exception>
+#include <stdexcept>
 #include <string>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "AllocationTracker.h"
+#include "ContainerTrace.h"
+#include "DeferredReclaimer.h"
+
+// Forward declaration
+template<class T> class List;
 
 template<class T>
 class Array{
@@ -30,6 +55,9 @@ public:
     Array(const T* const source, const size_t size);    // Construct via traditional array
     Array(std::initializer_list<T> initializerList);
 
+    template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+    Array(InputIterator begin, InputIterator end);      // Range constructor
+
     virtual ~Array(); // Destructor defined virtual to support efficient polymorphism
 
     const T& operator[](const size_t index) const;      // Subscript operator for const objects returns rValue
@@ -40,6 +68,14 @@ public:
 
     const Array<T>& operator=(const Array<T>& rightArr);    // Array assignment
 
+    /*** Selection ***/
+    template<class Compare = std::less<T>>
+    void PartialSort(const size_t k, Compare compare = Compare());     // The k smallest elements first, in order
+    template<class Compare = std::less<T>>
+    void NthElement(const size_t n, Compare compare = Compare());      // The n-th element in place, the smaller ones before it
+    template<class Compare = std::less<T>>
+    Array<T> TopK(const size_t k, Compare compare = Compare()) const;  // Copies of the k smallest elements, in order
+
     /* Declaring a function as a friend inside of a template class
        corrupts the template usage. You may want to check the holy StackOverflow :)
        stackoverflow.com/questions/4660123 */
@@ -49,12 +85,41 @@ public:
     template<class _T>
     friend std::istream& operator>>(std::istream& stream, Array<_T>& array);
 
+    /*** Bulk Conversion ***/
+    template<class _T>
+    friend Array<_T> ToArray(List<_T>&& list);      // Moves the elements into an array, see ListArrayConversion.h
+    template<class _T>
+    friend List<_T> FromArray(Array<_T>&& array);   // Moves the elements into a list, see ListArrayConversion.h
+
     size_t getSize(void) const
     { return (container == nullptr) ? 0 : size; }
 
+    /*** Iterators ***/
+    // Raw pointers are used as iterators since the elements are contiguous
+    T* begin()              { return container;                 }
+    T* end()                { return container + getSize();     }
+    const T* begin() const  { return container;                 }
+    const T* end() const    { return container + getSize();     }
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    /*** Allocation Tracking ***/
+    AllocationStatistics GetAllocationStatistics() const    // Element allocations made by this array
+    { return allocationProbe.GetStatistics(getSize() * sizeof(T)); }
+    void ResetAllocationStatistics()
+    { allocationProbe.Reset(getSize() * sizeof(T)); }
+#endif
+
 private:
+    T* AllocateElements(const size_t count);    // Every element block of the array comes from here
+    void ReleaseElements();                     // Frees the current element block
+    static void ReclaimElements(void* block, size_t count); // Frees a detached block, run by the deferred reclaimer
+
     const size_t size   = 0;        // Size will be initialized at constructor
     T* container        = nullptr;  // Pointer will be used for addressing the allocated area
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    AllocationProbe allocationProbe;    // Allocation counters of this array
+#endif
 };
 
 
@@ -70,7 +135,7 @@ Array<T>::Array(const size_t arraySize)
     if(size == 0)    // Create array only if the size is valid(positive)
         throw std::logic_error("Array size cannot be zero!");
 
-    container = new T[size];
+    container = AllocateElements(size);
 }
 
 /**
@@ -85,7 +150,7 @@ Array<T>::Array(const Array<T>& copyArr)
     if(size == 0)    // Create array only if the size is valid(positive)
         throw std::logic_error("Array size cannot be zero!");
 
-    container = new T[size];    // Allocate space to copy elements
+    container = AllocateElements(size);     // Allocate space to copy elements
 
     // Element wise copy
     for(size_t index = 0; index < copyArr.getSize(); index++)
@@ -109,6 +174,10 @@ Array<T>::Array(Array<T>&& moveArr)
        prevents destroying its content as we used its resources
        to construct the new one.*/
     moveArr.container = nullptr;
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    allocationProbe.OnOwnershipChange(getSize() * sizeof(T));   // Taken over without an allocation
+#endif
 }
 
 /**
@@ -128,7 +197,7 @@ Array<T>::Array(const T* const source, const size_t size)
         throw std::logic_error("Invalid source!");
     else;
 
-    container = new T[size];    // Allocate space to copy elements
+    container = AllocateElements(size);     // Allocate space to copy elements
 
     for(size_t index = 0; index < size; index++)    // Element wise copy
         (*this)[index] = source[index];
@@ -146,20 +215,74 @@ Array<T>::Array(std::initializer_list<T> initializerList)
     if(size == 0)    // Create array only if the size is valid(positive)
         throw std::logic_error("Array size cannot be zero!");
 
-    container = new T[size];    // Allocate space to copy elements
+    container = AllocateElements(size);     // Allocate space to copy elements
 
     size_t index = 0;   // Element wise copy
     for(const T& element : initializerList)
         container[index++] = element;
 }
 
+/**
+ * @brief   Constructs an array with the elements of the range [begin, end), in the same order.
+ * @param   begin   Input iterator to the initial position in a range.
+ * @param   end     Input iterator to the final position in a range.
+ * @throws  std::logic_error When the range is empty
+ * @note    Single pass input iterators (e.g. stream iterators) are collected into a temporary
+ *          buffer first, as the size must be known before the allocation.
+ */
+template<class T>
+template<class InputIterator, class>
+Array<T>::Array(InputIterator begin, InputIterator end)
+: size(0), container(nullptr)
+{
+    using Category = typename std::iterator_traits<InputIterator>::iterator_category;
+
+    if constexpr(std::is_base_of<std::forward_iterator_tag, Category>::value)
+    {
+        const_cast<size_t&>(size) = static_cast<size_t>(std::distance(begin, end));
+
+        if(size == 0)    // Create array only if the size is valid(positive)
+            throw std::logic_error("Array size cannot be zero!");
+
+        container = AllocateElements(size);     // Allocate space to copy elements
+
+        for(size_t index = 0; begin != end; ++begin)    // Element wise copy
+            container[index++] = *begin;
+    }
+    else
+    {
+        std::vector<T> buffer(begin, end);  // Range can be traversed only once
+
+        const_cast<size_t&>(size) = buffer.size();
+
+        if(size == 0)    // Create array only if the size is valid(positive)
+            throw std::logic_error("Array size cannot be zero!");
+
+        container = AllocateElements(size);     // Allocate space to move elements
+
+        for(size_t index = 0; index < size; index++)
+            container[index] = std::move(buffer[index]);
+    }
+}
+
 /**
  * @brief Destructor
  */
 template<class T>
 Array<T>::~Array()
 {
-    delete [] container;    // Deleting a nullptr is safe, don't worry
+#if defined(CONTAINER_DEFERRED_RECLAMATION)
+    // Large blocks are handed to the background reclaimer in O(1)
+    if(DeferredReclaimer::Global().Defer(&Array<T>::ReclaimElements, container, getSize(), getSize() * sizeof(T)) == true)
+    {
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+        allocationProbe.OnFree(size * sizeof(T));
+#endif
+        return;
+    }
+#endif
+
+    ReleaseElements();      // Releasing a nullptr is safe, don't worry
 }
 
 
@@ -176,6 +299,8 @@ const T& Array<T>::operator[](const size_t index) const
     if(index < size)    // Check for out-of-range random access
         return container[index];
 
+    CONTAINER_TRACE_EVENT("Array::operator[] failed", this, getSize(), index);
+
     if(container == nullptr)
         throw std::logic_error("Container deleted or has not been allocated properly!");
 
@@ -200,6 +325,8 @@ T& Array<T>::operator[](const size_t index)
     if(index < size)    // Check for out-of-range random access
         return container[index];
 
+    CONTAINER_TRACE_EVENT("Array::operator[] failed", this, getSize(), index);
+
     if(container == nullptr)
         throw std::logic_error("Container deleted or has not been allocated properly!");
 
@@ -259,9 +386,9 @@ bool Array<T>::operator!=(const Array<T>& right) const
 template<class T>
 const Array<T>& Array<T>::operator=(const Array<T>& rightArr)
 {   // Return a const reference to support cascade assignments(e.g. arr = arr1 = arr2)
-    delete [] container;    // Destroy left array
+    ReleaseElements();      // Destroy left array
 
-    container = new T[rightArr.getSize()];              // Allocate space for incoming elements
+    container = AllocateElements(rightArr.getSize());   // Allocate space for incoming elements
     const_cast<size_t&>(size) = rightArr.getSize();     // Determine new array size
 
     // Element wise copy
@@ -313,3 +440,114 @@ std::istream& operator>>(std::istream& stream, Array<T>& array)
 
     return stream;  // Return reference to support cascade streaming
 }
+
+/**
+ * @brief   Moves the k smallest elements to the front in ascending order, in O(n + k log k).
+ * @param   k       Number of elements to be sorted, all elements are sorted if k is not less than the size.
+ * @param   compare Strict weak ordering, std::less by default. std::greater selects the largest ones.
+ * @note    The k smallest are found by introselect (std::nth_element), only they are sorted then.
+ *          The other elements follow in an unspecified order.
+ */
+template<class T>
+template<class Compare>
+void Array<T>::PartialSort(const size_t k, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("Array::PartialSort", this, getSize());
+
+    if(k < getSize())
+        std::nth_element(begin(), begin() + k, end(), compare);
+
+    std::sort(begin(), begin() + ((k < getSize()) ? k : getSize()), compare);
+}
+
+/**
+ * @brief   Places the element which would be at the given index of the sorted array at that index, in O(n).
+ * @param   n       Zero based index
+ * @param   compare Strict weak ordering, std::less by default.
+ * @throws  std::range_error If n is out of range.
+ * @note    Introselect: quickselect falling back to a median of medians like selection on bad pivots.
+ *          The elements before index n are not greater than it, the ones after are not less.
+ */
+template<class T>
+template<class Compare>
+void Array<T>::NthElement(const size_t n, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("Array::NthElement", this, getSize());
+
+    if(n >= getSize())
+    {
+        std::string errorMessage = "Out-of-Range Exception Occured ";
+                    errorMessage += "(Size = "  + std::to_string(getSize()) + ") ";
+                    errorMessage += "(Index = " + std::to_string(n)         + ") ";
+        throw std::range_error(errorMessage);
+    }
+
+    std::nth_element(begin(), begin() + n, end(), compare);
+}
+
+/**
+ * @brief   Copies the k smallest elements into a new array, in ascending order, in O(n log k).
+ * @param   k       Number of elements to be selected, all elements are copied if k is not less than the size.
+ * @param   compare Strict weak ordering, std::less by default. std::greater selects the largest ones.
+ * @return  Array of min(k, getSize()) elements, this array is left untouched.
+ * @throws  std::logic_error If k or the size is zero, as an array cannot be of size zero.
+ * @note    A single pass through a bounded heap of k elements, so no copy of the whole array is made.
+ */
+template<class T>
+template<class Compare>
+Array<T> Array<T>::TopK(const size_t k, Compare compare) const
+{
+    CONTAINER_TRACE_SCOPE("Array::TopK", this, getSize());
+
+    Array<T> selected((k < getSize()) ? k : getSize());
+    std::partial_sort_copy(begin(), end(), selected.begin(), selected.end(), compare);
+
+    return selected;
+}
+
+/**
+ * @brief   Allocates a block of default constructed elements.
+ * @param   count   Number of elements.
+ * @return  Address of the block.
+ * @note    Counted by the allocation tracker, if it is enabled.
+ */
+template<class T>
+T* Array<T>::AllocateElements(const size_t count)
+{
+    T* block = new T[count];
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    allocationProbe.OnAllocate(count * sizeof(T), count * sizeof(T));
+#endif
+
+    return block;
+}
+
+/**
+ * @brief   Destroys the elements and frees the current block.
+ * @note    The container pointer is left dangling, the caller either replaces it or is the destructor.
+ */
+template<class T>
+void Array<T>::ReleaseElements()
+{
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    if(container != nullptr)
+        allocationProbe.OnFree(size * sizeof(T));
+#endif
+
+    delete [] container;
+}
+
+/**
+ * @brief   Destroys the elements of a block which no array owns anymore and frees it.
+ * @param   block   Block allocated by AllocateElements.
+ * @param   count   Number of elements, unused as delete[] knows it.
+ */
+template<class T>
+void Array<T>::ReclaimElements(void* block, size_t count)
+{
+    (void)count;
+    delete [] static_cast<T*>(block);
+}
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,486 @@
+/** @file       AsyncLogIterator.h
+ *  @details    Asynchronous log sink with an ostream_iterator-like front end.
+ *              Callers format their records and push them into a bounded lock-free ring buffer.
+ *              A background thread drains the ring and writes the records in large batches,
+ *              so the calling threads never block on I/O.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *              October 18, 2026 -> Push latencies are recorded into a log-linear LatencyRecorder
+ *
+ *  @note       Link with -pthread.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef ASYNC_LOG_ITERATOR_H
+#define ASYNC_LOG_ITERATOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <memory>
+#include <iterator>
+#include <string_view>
+#include <cstring>
+#include <cstdint>
+
+#include <cerrno>
+#include <unistd.h>
+
+#include "FastOstreamIterator.h"
+#include "LatencyHistogram.h"
+
+// Forward declarations
+template<class T> class AsyncLogIterator;
+
+/**
+ * @brief   Behavior of the sink when the ring buffer is full.
+ */
+enum class OverflowPolicy{
+    Block,      // Caller waits until there is space
+    Drop,       // New record is discarded
+    Overwrite   // Oldest record is discarded to make room for the new one
+};
+
+/**
+ * @brief   Caller-side latency percentiles of the push operation, in nanoseconds.
+ */
+struct LatencyPercentiles{
+    uint64_t p50    = 0;
+    uint64_t p90    = 0;
+    uint64_t p99    = 0;
+    uint64_t p999   = 0;
+    uint64_t max    = 0;
+    uint64_t count  = 0;
+};
+
+/**
+ * @brief   Counters of the sink.
+ */
+struct AsyncLogStatistics{
+    uint64_t pushed         = 0;    // Records accepted into the ring
+    uint64_t written        = 0;    // Records written by the background thread
+    uint64_t dropped        = 0;    // Records rejected due to the Drop policy
+    uint64_t overwritten    = 0;    // Records evicted due to the Overwrite policy
+    uint64_t truncated      = 0;    // Records longer than maxRecordLength
+    uint64_t writeCalls     = 0;    // Number of write system calls
+};
+
+class AsyncLogSink{
+    template<class T>
+    friend class AsyncLogIterator;  // Counts the records it truncates itself
+
+public:
+    static constexpr size_t maxRecordLength = 500;  // Longer records are truncated
+    static constexpr size_t defaultCapacity = 8192; // Number of records in the ring
+
+    AsyncLogSink(const int fileDescriptor = STDERR_FILENO, const size_t capacity = defaultCapacity,
+                 const OverflowPolicy policy = OverflowPolicy::Block, const bool measureLatency = true);
+
+    AsyncLogSink(const AsyncLogSink&) = delete;
+    AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+    ~AsyncLogSink();    // Writes all pending records before returning
+
+    bool Push(const char* data, const size_t length);   // Enqueues a record, false if it was dropped
+    bool Push(std::string_view record) { return Push(record.data(), record.size()); }
+
+    void Flush();       // Waits until all records pushed so far are written
+
+    AsyncLogStatistics GetStatistics() const;
+    LatencyPercentiles GetLatencyPercentiles() const;
+
+private:
+    struct Slot{
+        std::atomic<size_t> sequence;   // Sequence number of the ring protocol
+        uint32_t length;                // Record length
+        char data[maxRecordLength];     // Record content
+    };
+
+    bool TryPush(const char* data, const size_t length);    // Non-blocking enqueue
+    template<class ConsumerType>
+    bool TryPop(ConsumerType consumer);                     // Non-blocking dequeue
+    void Drain();                                           // Background thread body
+    void WriteOut(const char* data, size_t length);         // Writes a batch to the descriptor
+
+    /*** Ring Buffer ***/
+    std::unique_ptr<Slot[]> slots;
+    size_t mask = 0;                                // Capacity - 1, capacity is a power of two
+    alignas(64) std::atomic<size_t> enqueuePos{0};  // Separate cache lines for producers and consumer
+    alignas(64) std::atomic<size_t> dequeuePos{0};
+
+    /*** Configuration ***/
+    const int fileDescriptor;
+    const OverflowPolicy policy;
+    const bool measureLatency;
+
+    /*** Background Thread ***/
+    std::thread drainer;
+    std::atomic<bool> stopRequested{false};
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;      // Wakes the drainer
+    std::condition_variable flushedCondition;   // Wakes the flushing callers
+
+    /*** Statistics ***/
+    alignas(64) std::atomic<uint64_t> pushed{0};
+    std::atomic<uint64_t> retired{0};           // Written or evicted records
+    std::atomic<uint64_t> written{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<uint64_t> overwritten{0};
+    std::atomic<uint64_t> truncated{0};
+    std::atomic<uint64_t> writeCalls{0};
+
+    LatencyRecorder pushLatency;                // One histogram per pushing thread
+};
+
+/**
+ * @brief   Constructs the sink and starts the background thread.
+ * @param   fileDescriptor  Destination descriptor, it is not closed by the sink.
+ * @param   capacity        Number of records the ring can hold, rounded up to a power of two.
+ * @param   policy          Behavior when the ring is full.
+ * @param   measureLatency  Enables the caller-side latency histogram.
+ * @throws  std::logic_error When the descriptor or the capacity is invalid.
+ */
+inline AsyncLogSink::AsyncLogSink(const int fileDescriptor, const size_t capacity,
+                                  const OverflowPolicy policy, const bool measureLatency)
+: fileDescriptor(fileDescriptor), policy(policy), measureLatency(measureLatency)
+{
+    if(fileDescriptor < 0)
+        throw std::logic_error("Invalid file descriptor!");
+    else if(capacity < 2)
+        throw std::logic_error("Ring capacity must be at least two!");
+    else;
+
+    size_t roundedCapacity = 2;
+    while(roundedCapacity < capacity)
+        roundedCapacity *= 2;
+
+    slots.reset(new Slot[roundedCapacity]);
+    mask = roundedCapacity - 1;
+
+    for(size_t index = 0; index < roundedCapacity; index++)
+        slots[index].sequence.store(index, std::memory_order_relaxed);
+
+    drainer = std::thread(&AsyncLogSink::Drain, this);
+}
+
+/**
+ * @brief   Stops the background thread after all pending records are written.
+ */
+inline AsyncLogSink::~AsyncLogSink()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopRequested = true;
+    }
+    wakeCondition.notify_one();
+
+    drainer.join();
+}
+
+/**
+ * @brief   Enqueues a record by applying the overflow policy.
+ * @param   data    Record content, copied into the ring.
+ * @param   length  Record length, truncated to maxRecordLength.
+ * @return  true    If the record was enqueued.
+ *          false   If it was dropped.
+ */
+inline bool AsyncLogSink::Push(const char* data, const size_t length)
+{
+    const auto start = measureLatency ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+    bool accepted = TryPush(data, length);
+
+    if(accepted == false)
+    {
+        switch(policy)
+        {
+        case OverflowPolicy::Block:
+            for(size_t attempt = 0; accepted == false; attempt++)
+            {
+                if(attempt > 64)    // Spin a little, then let the drainer run
+                    std::this_thread::yield();
+
+                accepted = TryPush(data, length);
+            }
+            break;
+
+        case OverflowPolicy::Drop:
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            break;
+
+        case OverflowPolicy::Overwrite:
+            while(accepted == false)
+            {
+                // Evict the oldest record, the ring protocol allows any thread to dequeue
+                if(TryPop([](const char*, size_t) { /* Discard */ }) == true)
+                {
+                    overwritten.fetch_add(1, std::memory_order_relaxed);
+                    retired.fetch_add(1, std::memory_order_release);
+                }
+
+                accepted = TryPush(data, length);
+            }
+            break;
+        }
+    }
+
+    if(measureLatency == true)
+        pushLatency.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+    return accepted;
+}
+
+/**
+ * @brief   Waits until all records pushed before the call are written or evicted.
+ */
+inline void AsyncLogSink::Flush()
+{
+    const uint64_t target = pushed.load(std::memory_order_acquire);
+
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    wakeCondition.notify_one();
+
+    flushedCondition.wait(lock, [&]() { return retired.load(std::memory_order_acquire) >= target; });
+}
+
+/**
+ * @brief   Takes a snapshot of the counters.
+ * @return  Counter values.
+ */
+inline AsyncLogStatistics AsyncLogSink::GetStatistics() const
+{
+    AsyncLogStatistics statistics;
+
+    statistics.pushed       = pushed.load(std::memory_order_relaxed);
+    statistics.written      = written.load(std::memory_order_relaxed);
+    statistics.dropped      = dropped.load(std::memory_order_relaxed);
+    statistics.overwritten  = overwritten.load(std::memory_order_relaxed);
+    statistics.truncated    = truncated.load(std::memory_order_relaxed);
+    statistics.writeCalls   = writeCalls.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+/**
+ * @brief   Computes the caller-side latency percentiles of Push.
+ * @return  Percentiles in nanoseconds.
+ * @note    Values are the highest values of log-linear buckets, except the maximum.
+ */
+inline LatencyPercentiles AsyncLogSink::GetLatencyPercentiles() const
+{
+    const LatencySummary summary = pushLatency.GetSummary();
+    LatencyPercentiles result;
+
+    result.p50      = summary.p50;
+    result.p90      = summary.p90;
+    result.p99      = summary.p99;
+    result.p999     = summary.p999;
+    result.max      = summary.max;
+    result.count    = summary.count;
+
+    return result;
+}
+
+/**
+ * @brief   Copies the record into a free slot of the ring.
+ * @param   data    Record content.
+ * @param   length  Record length.
+ * @return  false   If the ring is full.
+ * @note    Bounded MPMC sequence protocol by Dmitry Vyukov. Only the drainer dequeues
+ *          in normal operation, but producers evict in the Overwrite mode.
+ */
+inline bool AsyncLogSink::TryPush(const char* data, const size_t length)
+{
+    Slot* slot;
+    size_t position = enqueuePos.load(std::memory_order_relaxed);
+
+    while(true)
+    {
+        slot = &slots[position & mask];
+        const size_t sequence   = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t distance = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if(distance == 0)   // Slot is free, try to claim it
+        {
+            if(enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+                break;
+        }
+        else if(distance < 0)   // Ring is full
+            return false;
+        else    // Another producer claimed the slot
+            position = enqueuePos.load(std::memory_order_relaxed);
+    }
+
+    size_t copyLength = length;
+    if(copyLength > maxRecordLength)
+    {
+        copyLength = maxRecordLength;
+        truncated.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::memcpy(slot->data, data, copyLength);
+    slot->length = static_cast<uint32_t>(copyLength);
+
+    pushed.fetch_add(1, std::memory_order_release);
+    slot->sequence.store(position + 1, std::memory_order_release);  // Publish the record
+
+    return true;
+}
+
+/**
+ * @brief   Removes the oldest record from the ring.
+ * @param   consumer    Callable taking the record data and length.
+ * @return  false       If the ring is empty.
+ */
+template<class ConsumerType>
+bool AsyncLogSink::TryPop(ConsumerType consumer)
+{
+    Slot* slot;
+    size_t position = dequeuePos.load(std::memory_order_relaxed);
+
+    while(true)
+    {
+        slot = &slots[position & mask];
+        const size_t sequence   = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t distance = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+        if(distance == 0)   // Record is published, try to claim it
+        {
+            if(dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true)
+                break;
+        }
+        else if(distance < 0)   // Ring is empty
+            return false;
+        else    // Another consumer claimed the record
+            position = dequeuePos.load(std::memory_order_relaxed);
+    }
+
+    consumer(slot->data, slot->length);
+    slot->sequence.store(position + mask + 1, std::memory_order_release);  // Release the slot for the next round
+
+    return true;
+}
+
+/**
+ * @brief   Background thread body, drains the ring into batches.
+ * @note    The thread exits only after the ring is empty and a stop is requested,
+ *          which guarantees that no record is lost at shutdown.
+ */
+inline void AsyncLogSink::Drain()
+{
+    constexpr size_t batchCapacity = 64 * 1024;
+    std::unique_ptr<char[]> batch(new char[batchCapacity]);
+
+    while(true)
+    {
+        size_t batchLength = 0, batchRecords = 0;
+        const bool stopping = stopRequested.load(std::memory_order_acquire);    // Read before draining
+
+        // Collect as many records as fit into the batch
+        while((batchLength + maxRecordLength <= batchCapacity) &&
+              TryPop([&](const char* data, const size_t length)
+                     {
+                         std::memcpy(batch.get() + batchLength, data, length);
+                         batchLength += length;
+                     }))
+            batchRecords++;
+
+        if(batchLength > 0)
+            WriteOut(batch.get(), batchLength);
+
+        if(batchRecords > 0)
+        {
+            written.fetch_add(batchRecords, std::memory_order_relaxed);
+            retired.fetch_add(batchRecords, std::memory_order_release);
+
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            flushedCondition.notify_all();
+            continue;   // There may be more records
+        }
+
+        if(stopping == true)    // Ring was empty after the stop request
+            break;
+
+        // Producers don't notify, a short sleep keeps their fast path free of system calls
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        flushedCondition.notify_all();
+        wakeCondition.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
+/**
+ * @brief   Writes a batch to the descriptor.
+ * @param   data    Batch content.
+ * @param   length  Batch length.
+ * @note    Errors other than interrupts are ignored, a log sink has nowhere to report them.
+ */
+inline void AsyncLogSink::WriteOut(const char* data, size_t length)
+{
+    while(length > 0)
+    {
+        const ssize_t result = ::write(fileDescriptor, data, length);
+        writeCalls.fetch_add(1, std::memory_order_relaxed);
+
+        if(result < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            return;
+        }
+
+        data    += result;
+        length  -= static_cast<size_t>(result);
+    }
+}
+
+/**
+ * @brief   Output iterator pushing formatted records into an AsyncLogSink.
+ * @note    The iterator can be used wherever std::ostream_iterator is used.
+ *          Each assignment becomes a single record consisting of the value and the delimiter.
+ */
+template<class T>
+class AsyncLogIterator{
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+
+    AsyncLogIterator(AsyncLogSink& sink, const char* delimiter = nullptr)
+    : sink(&sink), delimiter(delimiter != nullptr ? delimiter : "")
+    { /* Empty constructor */ }
+
+    AsyncLogIterator& operator=(const T& value)     // Formats and pushes a record
+    {
+        // One extra byte reveals a value which does not fit, the delimiter is kept at the end of a cut record
+        char record[AsyncLogSink::maxRecordLength + 1];
+        const size_t maxLength      = AsyncLogSink::maxRecordLength;
+        const size_t valueCapacity  = (delimiter.size() < maxLength) ? (maxLength - delimiter.size()) : 0;
+
+        size_t length = FastFormat::FormatTo(record, valueCapacity + 1, value);
+        const bool truncated = (length > valueCapacity) || (delimiter.size() > maxLength);
+
+        length  = std::min(length, valueCapacity);
+        length += FastFormat::FormatTo(record + length, maxLength - length, delimiter);
+
+        if((sink->Push(record, length) == true) && (truncated == true))
+            sink->truncated.fetch_add(1, std::memory_order_relaxed);
+
+        return *this;
+    }
+
+    AsyncLogIterator& operator*()       { return *this; }   // No-op, as in std::ostream_iterator
+    AsyncLogIterator& operator++()      { return *this; }   // No-op, as in std::ostream_iterator
+    AsyncLogIterator& operator++(int)   { return *this; }   // No-op, as in std::ostream_iterator
+
+private:
+    AsyncLogSink* sink;             // Sink must outlive the iterator
+    std::string_view delimiter;     // Must outlive the iterator, like std::ostream_iterator
+};
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,132 @@
+// Description: Caller-side latency benchmark of AsyncLogIterator against a synchronous ostream_iterator
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread AsyncLogIteratorBenchmark.cpp -o AsyncLogIteratorBenchmark
+// Usage:       ./AsyncLogIteratorBenchmark [recordsPerThread] [threadCount] [outputPath]
+//              (defaults: 1000000, 4 and /dev/null)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Benchmark.h"
+#include "AsyncLogIterator.h"
+
+using namespace std;
+
+// Prints a result row
+static void Report(const string& name, const double seconds, const size_t records, const LatencyPercentiles& latency)
+{
+    cout << setw(28) << left << name << right
+         << setw(10) << fixed << setprecision(3) << seconds << " s"
+         << setw(12) << setprecision(2) << (records / seconds) / 1e6 << " M/s"
+         << setw(8) << latency.p50 << setw(8) << latency.p99 << setw(8) << latency.p999
+         << setw(10) << latency.max << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t recordsPerThread   = (argc > 1) ? stoull(argv[1]) : 1000000;
+    const size_t threadCount        = (argc > 2) ? stoull(argv[2]) : 4;
+    const char* path                = (argc > 3) ? argv[3] : "/dev/null";
+    const size_t totalRecords       = recordsPerThread * threadCount;
+
+    vector<string> errors{"Error 1: connection refused", "Error 2: timeout while reading", "Error 3: invalid header"};
+
+    cout << setw(28) << left << "Writer" << right << setw(12) << "Time" << setw(16) << "Throughput"
+         << setw(8) << "p50" << setw(8) << "p99" << setw(8) << "p999" << setw(10) << "max(ns)" << endl;
+
+    // Synchronous reference, a mutex serializes the threads as cerr would
+    {
+        ofstream file(path);
+        ostream_iterator<string> errorLog(file, "\r\n");
+        mutex logMutex;
+        vector<vector<uint64_t>> samples(threadCount);
+
+        Benchmark::Stopwatch watch;
+        vector<thread> threads;
+        for(size_t worker = 0; worker < threadCount; worker++)
+            threads.emplace_back([&, worker]()
+            {
+                samples[worker].reserve(recordsPerThread);
+                for(size_t index = 0; index < recordsPerThread; index++)
+                {
+                    Benchmark::Stopwatch callWatch;
+                    {
+                        lock_guard<mutex> lock(logMutex);
+                        errorLog = errors[index % errors.size()];
+                        file.flush();   // Error logs are unbuffered, as cerr is
+                    }
+                    samples[worker].push_back(callWatch.ElapsedNanoseconds());
+                }
+            });
+        for(thread& worker : threads)
+            worker.join();
+        const double seconds = watch.ElapsedSeconds();
+
+        // Exact percentiles from the collected samples
+        vector<uint64_t> all;
+        for(const vector<uint64_t>& workerSamples : samples)
+            all.insert(all.end(), workerSamples.begin(), workerSamples.end());
+        sort(all.begin(), all.end());
+
+        LatencyPercentiles latency;
+        latency.count   = all.size();
+        latency.p50     = all[(all.size() - 1) * 50 / 100];
+        latency.p90     = all[(all.size() - 1) * 90 / 100];
+        latency.p99     = all[(all.size() - 1) * 99 / 100];
+        latency.p999    = all[(all.size() - 1) * 999 / 1000];
+        latency.max     = all.back();
+
+        Report("ostream_iterator + mutex", seconds, totalRecords, latency);
+    }
+
+    const pair<const char*, OverflowPolicy> policies[] = {  {"AsyncLogIterator (Block)",       OverflowPolicy::Block},
+                                                            {"AsyncLogIterator (Drop)",        OverflowPolicy::Drop},
+                                                            {"AsyncLogIterator (Overwrite)",   OverflowPolicy::Overwrite}};
+    for(const auto& policy : policies)
+    {
+        const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        double seconds;
+        LatencyPercentiles latency;
+        AsyncLogStatistics statistics;
+
+        {
+            AsyncLogSink sink(fd, 16384, policy.second);
+
+            Benchmark::Stopwatch watch;
+            vector<thread> threads;
+            for(size_t worker = 0; worker < threadCount; worker++)
+                threads.emplace_back([&]()
+                {
+                    AsyncLogIterator<string> errorLog(sink, "\r\n");
+                    for(size_t index = 0; index < recordsPerThread; index++)
+                        errorLog = errors[index % errors.size()];
+                });
+            for(thread& worker : threads)
+                worker.join();
+
+            sink.Flush();
+            seconds     = watch.ElapsedSeconds();
+            latency     = sink.GetLatencyPercentiles();
+            statistics  = sink.GetStatistics();
+        }
+        close(fd);
+
+        Report(policy.first, seconds, totalRecords, latency);
+        cout << "    written: " << statistics.written << ", dropped: " << statistics.dropped
+             << ", overwritten: " << statistics.overwritten << ", write calls: " << statistics.writeCalls << endl;
+    }
+
+    return 0;
+}
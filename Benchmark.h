@@ -0,0 +1,219 @@
+/** @file       Benchmark.h
+ *  @details    Minimal helpers shared by the benchmark programs of the repo.
+ *              Provides a monotonic stopwatch, a best-of-N runner and an
+ *              optimization barrier to keep measured results alive.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *                                  Untimed setup runs and JSON result log added.
+ *                                  Optional hardware counters of the results added. (See PerfCounters.h)
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace Benchmark {
+
+/**
+ * @brief   Simple stopwatch based on the steady clock.
+ */
+class Stopwatch{
+public:
+    Stopwatch() : startPoint(std::chrono::steady_clock::now())
+    { /* Empty constructor */ }
+
+    void Restart()  { startPoint = std::chrono::steady_clock::now(); }
+
+    double ElapsedSeconds() const
+    { return std::chrono::duration<double>(std::chrono::steady_clock::now() - startPoint).count(); }
+
+    long long ElapsedNanoseconds() const
+    { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startPoint).count(); }
+
+private:
+    std::chrono::steady_clock::time_point startPoint;
+};
+
+/**
+ * @brief   Prevents the compiler from optimizing away the given value.
+ * @param   value   Value whose computation must be kept.
+ */
+template<class T>
+inline void DoNotOptimize(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief   Runs the given callable several times and returns the best duration.
+ * @param   repetitions Number of measured runs, at least one run is made.
+ * @param   callable    Work to be measured.
+ * @return  Duration of the fastest run in seconds.
+ * @note    Taking the minimum filters out the noise caused by the scheduler and page faults.
+ */
+template<class CallableType>
+double MeasureBest(const size_t repetitions, CallableType callable)
+{
+    double best = 0;
+
+    for(size_t run = 0; (run < repetitions) || (run == 0); run++)
+    {
+        Stopwatch watch;
+        callable();
+        const double elapsed = watch.ElapsedSeconds();
+
+        if((run == 0) || (elapsed < best))
+            best = elapsed;
+    }
+
+    return best;
+}
+
+/**
+ * @brief   Runs the given callable several times after an untimed setup and returns the best duration.
+ * @param   repetitions Number of measured runs, at least one run is made.
+ * @param   setup       Preparation before each run, e.g. building the input consumed by the callable.
+ * @param   callable    Work to be measured.
+ * @return  Duration of the fastest run in seconds.
+ */
+template<class SetupType, class CallableType>
+double MeasureBest(const size_t repetitions, SetupType setup, CallableType callable)
+{
+    double best = 0;
+
+    for(size_t run = 0; (run < repetitions) || (run == 0); run++)
+    {
+        setup();
+
+        Stopwatch watch;
+        callable();
+        const double elapsed = watch.ElapsedSeconds();
+
+        if((run == 0) || (elapsed < best))
+            best = elapsed;
+    }
+
+    return best;
+}
+
+/**
+ * @brief   Single measurement of a benchmark suite.
+ */
+struct Result{
+    std::string operation;      // e.g. "copy"
+    std::string container;      // e.g. "Array" or "std::vector"
+    std::string elementType;    // e.g. "int"
+    size_t size     = 0;        // Number of elements
+    double seconds  = 0;        // Best duration
+    std::vector<std::pair<std::string, uint64_t>> counters;    // Optional named counters, e.g. cache misses
+
+    double NanosecondsPerElement() const
+    { return (size != 0) ? (seconds * 1e9) / size : seconds * 1e9; }
+};
+
+/**
+ * @brief   Collects results and writes them as JSON, so runs of different versions can be compared.
+ */
+class ResultLog{
+public:
+    ResultLog(const std::string& suite, const std::string& label = "")
+    : suite(suite), label(label)
+    { /* Empty constructor */ }
+
+    void Add(const Result& result)  { results.push_back(result); }
+
+    const std::vector<Result>& GetResults() const { return results; }
+
+    void WriteJson(std::ostream& stream) const;     // Writes a single JSON document
+
+private:
+    static std::string Quote(const std::string& text);  // Escapes and quotes a JSON string
+
+    std::string suite;      // Name of the benchmark program
+    std::string label;      // Free text identifying the run, e.g. a version
+    std::vector<Result> results;
+};
+
+/**
+ * @brief   Writes the suite information and all results as a JSON document.
+ * @param   stream  Destination stream.
+ */
+inline void ResultLog::WriteJson(std::ostream& stream) const
+{
+    const std::ios::fmtflags flags      = stream.flags();
+    const std::streamsize precision     = stream.precision();
+
+    stream << "{\n  \"suite\": " << Quote(suite) << ",\n  \"label\": " << Quote(label)
+#if defined(__VERSION__)
+           << ",\n  \"compiler\": " << Quote(__VERSION__)
+#endif
+           << ",\n  \"results\": [";
+
+    for(size_t index = 0; index < results.size(); index++)
+    {
+        const Result& result = results[index];
+
+        stream << ((index == 0) ? "\n" : ",\n")
+               << "    {\"operation\": "      << Quote(result.operation)
+               << ", \"container\": "         << Quote(result.container)
+               << ", \"elementType\": "       << Quote(result.elementType)
+               << ", \"size\": "              << result.size
+               << ", \"seconds\": "           << std::scientific << std::setprecision(6) << result.seconds
+               << ", \"nsPerElement\": "      << std::fixed << std::setprecision(3) << result.NanosecondsPerElement();
+
+        if(result.counters.empty() == false)
+        {
+            stream << ", \"counters\": {";
+            for(size_t counter = 0; counter < result.counters.size(); counter++)
+                stream << ((counter == 0) ? "" : ", ") << Quote(result.counters[counter].first) << ": " << result.counters[counter].second;
+            stream << "}";
+        }
+
+        stream << "}";
+    }
+
+    stream << "\n  ]\n}\n";
+
+    stream.flags(flags);            // Leave the stream as it was
+    stream.precision(precision);
+}
+
+/**
+ * @brief   Escapes the special characters of a JSON string.
+ * @param   text    Raw text.
+ * @return  Quoted and escaped text.
+ */
+inline std::string ResultLog::Quote(const std::string& text)
+{
+    std::ostringstream quoted;
+    quoted << '"';
+
+    for(const char character : text)
+    {
+        if((character == '"') || (character == '\\'))
+            quoted << '\\' << character;
+        else if(static_cast<unsigned char>(character) < 0x20)
+            quoted << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec;
+        else
+            quoted << character;
+    }
+
+    quoted << '"';
+    return quoted.str();
+}
+
+} // namespace Benchmark
+
+#endif  // Prevent recursive inclusion
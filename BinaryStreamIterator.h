@@ -0,0 +1,402 @@
+/** @file       BinaryStreamIterator.h
+ *  @details    Binary counterparts of std::ostream_iterator and std::istream_iterator.
+ *              Records are written and read in their raw in-memory representation or,
+ *              for integers, in a compact varint encoding (LEB128, zigzag for signed types).
+ *              Writes are collected in a block buffer and reads are made in bulk, so there is
+ *              neither text formatting nor a stream call per element.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Raw records use the native byte order, the producer and the consumer must agree on it.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef BINARY_STREAM_ITERATOR_H
+#define BINARY_STREAM_ITERATOR_H
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <iterator>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <cerrno>
+#include <unistd.h>
+
+#include "FastOstreamIterator.h"
+
+/**
+ * @brief   On-wire representation of the records.
+ */
+enum class BinaryEncoding{
+    Raw,    // Native in-memory representation, sizeof(T) bytes per record
+    Varint  // Variable length integers, 1 to 10 bytes per record, zigzag for signed types
+};
+
+namespace BinaryDetail {
+
+constexpr size_t maxVarintLength = 10;  // 64 bits in 7-bit groups
+
+/**
+ * @brief   Maps a signed integer to an unsigned one so that small magnitudes stay small.
+ * @param   value   Signed value.
+ * @return  Zigzag encoded value, e.g. 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3
+ */
+template<class T>
+inline uint64_t ZigzagEncode(const T value)
+{
+    const int64_t wide = static_cast<int64_t>(value);
+    return (static_cast<uint64_t>(wide) << 1) ^ static_cast<uint64_t>(wide >> 63);
+}
+
+/**
+ * @brief   Reverses the zigzag mapping.
+ * @param   value   Zigzag encoded value.
+ * @return  Original signed value.
+ */
+inline int64_t ZigzagDecode(const uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/**
+ * @brief   Writes an unsigned integer in LEB128 form.
+ * @param   destination Output array of at least maxVarintLength bytes.
+ * @param   value       Value to be encoded.
+ * @return  Number of bytes written.
+ */
+inline size_t VarintEncode(char* destination, uint64_t value)
+{
+    size_t length = 0;
+
+    while(value >= 0x80)
+    {
+        destination[length++] = static_cast<char>((value & 0x7F) | 0x80);  // More bytes follow
+        value >>= 7;
+    }
+
+    destination[length++] = static_cast<char>(value);
+
+    return length;
+}
+
+} // namespace BinaryDetail
+
+/**
+ * @brief   Bulk reader for an input stream or a file descriptor.
+ */
+class InputBuffer{
+public:
+    static constexpr size_t defaultCapacity = 64 * 1024;
+
+    InputBuffer(std::istream& stream, const size_t capacity = defaultCapacity);     // Read from an input stream
+    InputBuffer(const int fileDescriptor, const size_t capacity = defaultCapacity); // Read from a file descriptor
+
+    InputBuffer(const InputBuffer&) = delete;
+    InputBuffer& operator=(const InputBuffer&) = delete;
+
+    bool Read(void* destination, const size_t length);  // Reads exactly length bytes, false at a clean end
+    bool ReadByte(uint8_t& byte);                       // Reads a single byte, false at the end
+
+private:
+    bool Refill();  // Reads the next block, false at the end
+
+    std::istream* stream    = nullptr;  // Source stream, nullptr if a file descriptor is used
+    int fileDescriptor      = -1;       // Source descriptor, -1 if a stream is used
+    size_t capacity         = 0;        // Buffer capacity in bytes
+    size_t position         = 0;        // Read position in the buffer
+    size_t available        = 0;        // Number of valid bytes in the buffer
+    std::unique_ptr<char[]> buffer;     // Internal buffer
+};
+
+/**
+ * @brief   Constructs a reader over an input stream.
+ * @param   stream      Source stream, should be opened in binary mode.
+ * @param   capacity    Buffer size in bytes.
+ * @throws  std::logic_error When the capacity is zero.
+ */
+inline InputBuffer::InputBuffer(std::istream& stream, const size_t capacity)
+: stream(&stream), fileDescriptor(-1), capacity(capacity), position(0), available(0), buffer(nullptr)
+{
+    if(capacity == 0)
+        throw std::logic_error("Input buffer size cannot be zero!");
+
+    buffer.reset(new char[capacity]);
+}
+
+/**
+ * @brief   Constructs a reader over a file descriptor.
+ * @param   fileDescriptor  Source descriptor, it is not closed by the buffer.
+ * @param   capacity        Buffer size in bytes.
+ * @throws  std::logic_error When the capacity is zero or the descriptor is invalid.
+ */
+inline InputBuffer::InputBuffer(const int fileDescriptor, const size_t capacity)
+: stream(nullptr), fileDescriptor(fileDescriptor), capacity(capacity), position(0), available(0), buffer(nullptr)
+{
+    if(capacity == 0)
+        throw std::logic_error("Input buffer size cannot be zero!");
+    else if(fileDescriptor < 0)
+        throw std::logic_error("Invalid file descriptor!");
+    else;
+
+    buffer.reset(new char[capacity]);
+}
+
+/**
+ * @brief   Reads the given amount of bytes.
+ * @param   destination Output area.
+ * @param   length      Number of bytes to read.
+ * @return  true    If all bytes are read.
+ *          false   If the source ended before the first byte.
+ * @throws  std::runtime_error If the source ended in the middle of the record.
+ */
+inline bool InputBuffer::Read(void* destination, const size_t length)
+{
+    char* output = static_cast<char*>(destination);
+    size_t copied = 0;
+
+    while(copied < length)
+    {
+        if((position == available) && (Refill() == false))
+        {
+            if(copied == 0)
+                return false;
+
+            throw std::runtime_error("Truncated binary record!");
+        }
+
+        const size_t chunk = std::min(length - copied, available - position);
+        std::memcpy(output + copied, buffer.get() + position, chunk);
+        position    += chunk;
+        copied      += chunk;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Reads a single byte.
+ * @param   byte    Output byte.
+ * @return  false   If the source ended.
+ */
+inline bool InputBuffer::ReadByte(uint8_t& byte)
+{
+    if((position == available) && (Refill() == false))
+        return false;
+
+    byte = static_cast<uint8_t>(buffer[position++]);
+    return true;
+}
+
+/**
+ * @brief   Reads the next block from the source.
+ * @return  false   If the source ended.
+ * @throws  std::system_error When the read fails.
+ */
+inline bool InputBuffer::Refill()
+{
+    position = available = 0;
+
+    if(stream != nullptr)
+    {
+        stream->read(buffer.get(), static_cast<std::streamsize>(capacity));
+        available = static_cast<size_t>(stream->gcount());
+
+        return (available > 0);
+    }
+
+    while(true)
+    {
+        const ssize_t result = ::read(fileDescriptor, buffer.get(), capacity);
+
+        if(result >= 0)
+        {
+            available = static_cast<size_t>(result);
+            return (available > 0);
+        }
+
+        if(errno != EINTR)
+            throw std::system_error(errno, std::generic_category(), "Read failed!");
+    }
+}
+
+/**
+ * @brief   Output iterator writing binary records into a shared OutputBuffer.
+ * @note    Copies of the iterator share the buffer. It is flushed when the last copy
+ *          is destroyed or when Flush() is called.
+ */
+template<class T>
+class BinaryOutputIterator{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary records must be trivially copyable!");
+
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+
+    BinaryOutputIterator(std::ostream& stream, const BinaryEncoding encoding = BinaryEncoding::Raw,
+                         const size_t bufferSize = OutputBuffer::defaultCapacity)
+    : buffer(std::make_shared<OutputBuffer>(stream, bufferSize)), encoding(encoding)
+    { CheckEncoding(); }
+
+    BinaryOutputIterator(const int fileDescriptor, const BinaryEncoding encoding = BinaryEncoding::Raw,
+                         const size_t bufferSize = OutputBuffer::defaultCapacity)
+    : buffer(std::make_shared<OutputBuffer>(fileDescriptor, bufferSize)), encoding(encoding)
+    { CheckEncoding(); }
+
+    BinaryOutputIterator& operator=(const T& value)     // Writes a record
+    {
+        if constexpr(std::is_integral<T>::value)
+        {
+            if(encoding == BinaryEncoding::Varint)
+            {
+                const uint64_t wide = std::is_signed<T>::value  ? BinaryDetail::ZigzagEncode(value)
+                                                                : static_cast<uint64_t>(value);
+
+                char* position = buffer->Reserve(BinaryDetail::maxVarintLength);
+                buffer->Commit(BinaryDetail::VarintEncode(position, wide));
+                return *this;
+            }
+        }
+
+        buffer->Append(reinterpret_cast<const char*>(&value), sizeof(T));
+        return *this;
+    }
+
+    BinaryOutputIterator& operator*()       { return *this; }   // No-op, as in std::ostream_iterator
+    BinaryOutputIterator& operator++()      { return *this; }   // No-op, as in std::ostream_iterator
+    BinaryOutputIterator& operator++(int)   { return *this; }   // No-op, as in std::ostream_iterator
+
+    void Flush() { buffer->Flush(); }   // Writes the buffered records out
+
+private:
+    void CheckEncoding() const
+    {
+        if((encoding == BinaryEncoding::Varint) && (std::is_integral<T>::value == false))
+            throw std::logic_error("Varint encoding requires an integral type!");
+    }
+
+    std::shared_ptr<OutputBuffer> buffer;   // Shared between the copies of the iterator
+    BinaryEncoding encoding;
+};
+
+/**
+ * @brief   Input iterator reading binary records through a shared InputBuffer.
+ * @note    Behaves like std::istream_iterator: a default constructed iterator is the end
+ *          of stream iterator, and the iterator becomes equal to it once the source ends.
+ */
+template<class T>
+class BinaryInputIterator{
+    static_assert(std::is_trivially_copyable<T>::value, "Binary records must be trivially copyable!");
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    BinaryInputIterator() = default;    // End of stream iterator
+
+    BinaryInputIterator(std::istream& stream, const BinaryEncoding encoding = BinaryEncoding::Raw,
+                        const size_t bufferSize = InputBuffer::defaultCapacity)
+    : buffer(std::make_shared<InputBuffer>(stream, bufferSize)), encoding(encoding)
+    { CheckEncoding(); ReadNext(); }
+
+    BinaryInputIterator(const int fileDescriptor, const BinaryEncoding encoding = BinaryEncoding::Raw,
+                        const size_t bufferSize = InputBuffer::defaultCapacity)
+    : buffer(std::make_shared<InputBuffer>(fileDescriptor, bufferSize)), encoding(encoding)
+    { CheckEncoding(); ReadNext(); }
+
+    const T& operator*() const  { return value;     }
+    const T* operator->() const { return &value;    }
+
+    BinaryInputIterator& operator++()   // Reads the next record
+    {
+        ReadNext();
+        return *this;
+    }
+
+    BinaryInputIterator operator++(int) // Reads the next record, returns the previous state
+    {
+        BinaryInputIterator previous = *this;
+        ReadNext();
+        return previous;
+    }
+
+    // Two iterators are equal if both reached the end or both refer to the same source
+    bool operator==(const BinaryInputIterator& anotherIt) const { return (buffer == anotherIt.buffer);  }
+    bool operator!=(const BinaryInputIterator& anotherIt) const { return !operator==(anotherIt);        }
+
+private:
+    void CheckEncoding() const
+    {
+        if((encoding == BinaryEncoding::Varint) && (std::is_integral<T>::value == false))
+            throw std::logic_error("Varint encoding requires an integral type!");
+    }
+
+    void ReadNext();
+
+    std::shared_ptr<InputBuffer> buffer;    // nullptr once the end is reached
+    BinaryEncoding encoding = BinaryEncoding::Raw;
+    T value{};                              // Last record read
+};
+
+/**
+ * @brief   Reads the next record, turns into the end iterator at the end of the source.
+ * @throws  std::runtime_error When the last record is truncated or a varint is malformed.
+ */
+template<class T>
+void BinaryInputIterator<T>::ReadNext()
+{
+    if(buffer == nullptr)
+        return;
+
+    if constexpr(std::is_integral<T>::value)
+    {
+        if(encoding == BinaryEncoding::Varint)
+        {
+            uint64_t wide = 0;
+            uint8_t byte  = 0;
+
+            for(size_t index = 0; ; index++)
+            {
+                if(buffer->ReadByte(byte) == false)
+                {
+                    if(index != 0)
+                        throw std::runtime_error("Truncated varint record!");
+
+                    buffer = nullptr;   // Clean end of the source
+                    return;
+                }
+
+                if(index == BinaryDetail::maxVarintLength)
+                    throw std::runtime_error("Malformed varint record!");
+
+                wide |= static_cast<uint64_t>(byte & 0x7F) << (7 * index);
+
+                if((byte & 0x80) == 0)
+                    break;
+            }
+
+            if constexpr(std::is_signed<T>::value)
+                value = static_cast<T>(BinaryDetail::ZigzagDecode(wide));
+            else
+                value = static_cast<T>(wide);
+
+            return;
+        }
+    }
+
+    if(buffer->Read(&value, sizeof(T)) == false)
+        buffer = nullptr;   // Clean end of the source
+}
+
+#endif  // Prevent recursive inclusion
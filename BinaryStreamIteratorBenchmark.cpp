@@ -0,0 +1,110 @@
+// Description: Text versus binary record streams, written and loaded into Array and List containers
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 BinaryStreamIteratorBenchmark.cpp -o BinaryStreamIteratorBenchmark
+// Usage:       ./BinaryStreamIteratorBenchmark [elementCount] [filePath]
+//              (defaults: 10000000 and /tmp/BinaryStreamIterator.dat)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+
+#include "Benchmark.h"
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "BinaryStreamIterator.h"
+
+using namespace std;
+
+// Returns the size of the given file
+static size_t FileSize(const char* path)
+{
+    ifstream file(path, ios::binary | ios::ate);
+    return static_cast<size_t>(file.tellg());
+}
+
+// Prints a result row
+static void Report(const string& name, const double writeSeconds, const double readSeconds, const size_t bytes)
+{
+    cout << setw(16) << left << name << right
+         << setw(12) << bytes
+         << setw(12) << fixed << setprecision(4) << writeSeconds
+         << setw(12) << readSeconds << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t elementCount   = (argc > 1) ? stoull(argv[1]) : 10000000;
+    const char* path            = (argc > 2) ? argv[2] : "/tmp/BinaryStreamIterator.dat";
+
+    // Mostly small values with a few large ones, typical of ids and deltas
+    vector<int> input(elementCount);
+    mt19937 generator(42);
+    geometric_distribution<int> magnitude(0.01);
+    for(size_t index = 0; index < elementCount; index++)
+        input[index] = ((index % 2) ? 1 : -1) * magnitude(generator);
+
+    cout << setw(16) << left << "Format" << right << setw(12) << "Bytes"
+         << setw(12) << "Write(s)" << setw(12) << "Read(s)" << endl;
+
+    // Text reference, read back into an Array through the range constructor
+    {
+        const double writeTime = Benchmark::MeasureBest(1, [&]()
+        {
+            ofstream file(path);
+            copy(input.begin(), input.end(), ostream_iterator<int>(file, " "));
+        });
+
+        const double readTime = Benchmark::MeasureBest(1, [&]()
+        {
+            ifstream file(path);
+            Array<int> loaded{istream_iterator<int>(file), istream_iterator<int>()};
+            if(equal(loaded.begin(), loaded.end(), input.begin()) == false)
+                cerr << "Text round trip failed!" << endl;
+        });
+
+        Report("Text", writeTime, readTime, FileSize(path));
+    }
+
+    const pair<const char*, BinaryEncoding> encodings[] = { {"Binary raw",      BinaryEncoding::Raw},
+                                                            {"Binary varint",   BinaryEncoding::Varint}};
+    for(const auto& encoding : encodings)
+    {
+        const double writeTime = Benchmark::MeasureBest(1, [&]()
+        {
+            ofstream file(path, ios::binary);
+            copy(input.begin(), input.end(), BinaryOutputIterator<int>(file, encoding.second));
+        });
+
+        const double readTime = Benchmark::MeasureBest(1, [&]()
+        {
+            ifstream file(path, ios::binary);
+            Array<int> loaded{BinaryInputIterator<int>(file, encoding.second), BinaryInputIterator<int>()};
+            if(equal(loaded.begin(), loaded.end(), input.begin()) == false)
+                cerr << encoding.first << " round trip failed!" << endl;
+        });
+
+        Report(encoding.first, writeTime, readTime, FileSize(path));
+    }
+
+    // List range construction from a binary stream
+    {
+        ifstream file(path, ios::binary);
+        Benchmark::Stopwatch watch;
+        List<int> loaded(BinaryInputIterator<int>(file, BinaryEncoding::Varint), BinaryInputIterator<int>());
+        const double readTime = watch.ElapsedSeconds();
+
+        cout << "List<int> loaded " << loaded.GetNodeCount() << " varint records in "
+             << readTime << " s" << endl;
+    }
+
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Description: Allocation cost of common Array and List operations, measured with the allocation tracker
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 ContainerAllocations.cpp -o ContainerAllocations
+// Usage:       ./ContainerAllocations
+
+// Tracking changes the layout of the containers, so it must be enabled before any inclusion
+#define CONTAINER_ALLOCATION_TRACKING
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <utility>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+
+using namespace std;
+
+// Prints the events of an operation
+static void Report(const string& operation, const AllocationStatistics& delta)
+{
+    cout << setw(32) << left << operation << right
+         << " allocations: " << setw(4) << delta.allocations
+         << "  frees: "      << setw(4) << delta.frees
+         << "  bytes: "      << setw(6) << delta.bytesAllocated << endl;
+}
+
+// Runs the operation and reports the program wide events it caused
+template<class OperationType>
+static void Measure(const string& operation, OperationType function)
+{
+    AllocationTracker::Scope scope;
+    function();
+    Report(operation, scope.GetDelta());
+}
+
+int main()
+{
+    cout << "Operations on lists of 100 integers" << endl;
+
+    List<int> list;
+    for(int value = 0; value < 100; value++)
+        list.Append(value);
+
+    List<int> other(100);
+
+    // Locals of the lambdas are destroyed inside the measurement, so their frees are counted too
+    Measure("List copy and destroy",        [&]() { List<int> copy(list);                   });
+    Measure("List move and destroy",        [&]() { List<int> moved(std::move(other));      });
+    Measure("List Resize(150)",             [&]() { list.Resize(150);                       });
+    Measure("List Resize(100)",             [&]() { list.Resize(100);                       });
+    Measure("List RemoveIf(odd)",           [&]() { list.RemoveIf([](int value) { return value % 2 != 0; }); });
+
+    List<int> merged{1, 3, 5, 7}, sorted{2, 4, 6, 8};
+    Measure("List Merge",                   [&]() { merged.Merge(sorted);                   });
+    Measure("List Concatenate",             [&]() { list.Concatenate(merged);               });
+
+    cout << endl << "Operations on arrays of 100 integers" << endl;
+
+    Array<int> array(100);
+    Array<int> another(50);
+    Array<int> source(100);
+
+    Measure("Array copy and destroy",       [&]() { Array<int> copy(array);                 });
+    Measure("Array move and destroy",       [&]() { Array<int> moved(std::move(source));    });
+    Measure("Array assignment",             [&]() { another = array;                        });
+    Measure("Array operator== and []",      [&]() { return (array == another) && (array[5] == another[5]); });
+
+    cout << endl << "Per instance counters" << endl;
+    cout << "list:    " << list.GetAllocationStatistics().ToText()    << endl;
+    cout << "array:   " << array.GetAllocationStatistics().ToText()   << endl;
+    cout << "another: " << another.GetAllocationStatistics().ToText() << endl;
+    cout << "global:  " << AllocationTracker::GetGlobalStatistics().ToText() << endl;
+
+    return 0;
+}
@@ -0,0 +1,339 @@
+// Description: Micro-benchmarks of Array and List against std::vector and std::list, results written as JSON
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 ContainerBenchmark.cpp -o ContainerBenchmark
+// Usage:       ./ContainerBenchmark [outputPath] [label]
+//              (defaults: ContainerBenchmark.json and an empty label)
+//              The label is stored in the JSON file, e.g. a commit hash, to compare versions.
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <list>
+#include <optional>
+#include <algorithm>
+#include <random>
+#include <functional>
+#include <cstdio>
+
+#include "Benchmark.h"
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+
+using namespace std;
+
+static const size_t repetitions = 5;
+
+// Names written into the results
+template<class T> struct TypeName;
+template<> struct TypeName<int>     { static constexpr const char* value = "int";           };
+template<> struct TypeName<double>  { static constexpr const char* value = "double";        };
+template<> struct TypeName<string>  { static constexpr const char* value = "std::string";   };
+
+// Values grow with the index, so the generated sequences are sorted for every type
+template<class T> T MakeValue(const size_t index);
+template<> int MakeValue<int>(const size_t index)       { return static_cast<int>(index);   }
+template<> double MakeValue<double>(const size_t index) { return index * 0.5;               }
+template<> string MakeValue<string>(const size_t index)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "item%010zu", index);  // Long enough to defeat the small string optimization
+    return text;
+}
+
+// Cheap reduction used to consume the elements
+template<class T>
+static double Weight(const T& value)
+{
+    if constexpr(is_arithmetic<T>::value)
+        return static_cast<double>(value);
+    else
+        return static_cast<double>(value.size());
+}
+
+// Stores the result and prints a table row
+static void Record(Benchmark::ResultLog& log, const string& operation, const string& container,
+                   const char* elementType, const size_t size, const double seconds)
+{
+    Benchmark::Result result;
+    result.operation    = operation;
+    result.container    = container;
+    result.elementType  = elementType;
+    result.size         = size;
+    result.seconds      = seconds;
+    log.Add(result);
+
+    cout << setw(14) << left << operation << setw(13) << container << setw(13) << elementType << right
+         << setw(10) << size << setw(14) << fixed << setprecision(3) << result.NanosecondsPerElement() << " ns/elem" << endl;
+}
+
+template<class T>
+static void RunArraySuite(Benchmark::ResultLog& log, const size_t size)
+{
+    const char* type = TypeName<T>::value;
+
+    vector<T> values(size);
+    for(size_t index = 0; index < size; index++)
+        values[index] = MakeValue<T>(index);
+
+    const Array<T> sourceArray(values.begin(), values.end());
+    const vector<T> sourceVector(values);
+
+    Record(log, "construct", "Array", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        Array<T> array(size);
+        Benchmark::DoNotOptimize(array.begin());
+    }));
+    Record(log, "construct", "std::vector", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        vector<T> vector(size);
+        Benchmark::DoNotOptimize(vector.data());
+    }));
+
+    Record(log, "copy", "Array", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        Array<T> array(sourceArray);
+        Benchmark::DoNotOptimize(array.begin());
+    }));
+    Record(log, "copy", "std::vector", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        vector<T> vector(sourceVector);
+        Benchmark::DoNotOptimize(vector.data());
+    }));
+
+    // Moved-to objects are kept alive, so their destruction is not measured
+    optional<Array<T>> arrayFrom, arrayTo;
+    Record(log, "move", "Array", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { arrayTo.reset(); arrayFrom.emplace(sourceArray); },
+        [&]() { arrayTo.emplace(std::move(*arrayFrom)); }));
+
+    optional<vector<T>> vectorFrom, vectorTo;
+    Record(log, "move", "std::vector", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { vectorTo.reset(); vectorFrom.emplace(sourceVector); },
+        [&]() { vectorTo.emplace(std::move(*vectorFrom)); }));
+
+    arrayTo.reset();
+    vectorTo.reset();
+
+    const Array<T> equalArray(sourceArray);
+    const vector<T> equalVector(sourceVector);
+
+    Record(log, "equality", "Array", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        Benchmark::DoNotOptimize(sourceArray == equalArray);
+    }));
+    Record(log, "equality", "std::vector", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        Benchmark::DoNotOptimize(sourceVector == equalVector);
+    }));
+
+    Record(log, "subscript", "Array", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        double sum = 0;
+        for(size_t index = 0; index < size; index++)
+            sum += Weight(sourceArray[index]);
+        Benchmark::DoNotOptimize(sum);
+    }));
+    Record(log, "subscript", "std::vector", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        double sum = 0;
+        for(size_t index = 0; index < size; index++)
+            sum += Weight(sourceVector[index]);
+        Benchmark::DoNotOptimize(sum);
+    }));
+
+    // Same text layout for both, the Array operator writes each element followed by a space
+    Record(log, "stream_out", "Array", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ostringstream stream;
+        stream << sourceArray;
+        Benchmark::DoNotOptimize(stream.tellp());
+    }));
+    Record(log, "stream_out", "std::vector", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ostringstream stream;
+        for(const T& value : sourceVector)
+            stream << value << " ";
+        Benchmark::DoNotOptimize(stream.tellp());
+    }));
+
+    ostringstream text;
+    text << sourceArray;
+    const string input = text.str();
+
+    Record(log, "stream_in", "Array", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        istringstream stream(input);
+        Array<T> array(size);
+        stream >> array;
+        Benchmark::DoNotOptimize(array.begin());
+    }));
+    Record(log, "stream_in", "std::vector", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        istringstream stream(input);
+        vector<T> vector(size);
+        for(T& value : vector)
+            stream >> value;
+        Benchmark::DoNotOptimize(vector.data());
+    }));
+}
+
+template<class T>
+static void RunListSuite(Benchmark::ResultLog& log, const size_t size)
+{
+    const char* type = TypeName<T>::value;
+    const hash<T> hasher;
+
+    vector<T> values(size);
+    for(size_t index = 0; index < size; index++)
+        values[index] = MakeValue<T>(index);
+
+    auto isOdd = [&](const T& value) { return (hasher(value) & 1) != 0; };
+
+    optional<List<T>> ownList, ownOther;
+    optional<list<T>> stdList, stdOther;
+
+    Record(log, "append", "List", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { ownList.emplace(); },
+        [&]() { for(const T& value : values) ownList->Append(value); }));
+    Record(log, "append", "std::list", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { stdList.emplace(); },
+        [&]() { for(const T& value : values) stdList->push_back(value); }));
+
+    Record(log, "prepend", "List", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { ownList.emplace(); },
+        [&]() { for(const T& value : values) ownList->Prepend(value); }));
+    Record(log, "prepend", "std::list", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { stdList.emplace(); },
+        [&]() { for(const T& value : values) stdList->push_front(value); }));
+
+    // Worst case search, the key is the last element. List exposes its search through the replace methods.
+    ownList.emplace(values.begin(), values.end());
+    stdList.emplace(values.begin(), values.end());
+    const T key = values.back();
+
+    Record(log, "find", "List", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ownList->ReplaceFirstWith(key, key);
+    }));
+    Record(log, "find", "std::list", type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        Benchmark::DoNotOptimize(*find(stdList->begin(), stdList->end(), key));
+    }));
+
+    Record(log, "remove_if", "List", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { ownList.emplace(values.begin(), values.end()); },
+        [&]() { ownList->RemoveIf(isOdd); }));
+    Record(log, "remove_if", "std::list", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { stdList.emplace(values.begin(), values.end()); },
+        [&]() { stdList->remove_if(isOdd); }));
+
+    // Two sorted halves interleaved by value
+    vector<T> evens, odds;
+    for(size_t index = 0; index < size; index++)
+        ((index % 2 == 0) ? evens : odds).push_back(values[index]);
+
+    Record(log, "merge", "List", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { ownList.emplace(evens.begin(), evens.end()); ownOther.emplace(odds.begin(), odds.end()); },
+        [&]() { ownList->Merge(*ownOther); }));
+    Record(log, "merge", "std::list", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { stdList.emplace(evens.begin(), evens.end()); stdOther.emplace(odds.begin(), odds.end()); },
+        [&]() { stdList->merge(*stdOther); }));
+
+    // Many pieces spliced into the same list, near its front
+    const size_t pieceCount = min<size_t>(256, size / 2);
+    const size_t pieceSize  = (size / 2) / pieceCount;
+    vector<List<T>> ownPieces;
+    vector<list<T>> stdPieces;
+
+    Record(log, "splice", "List", type, pieceCount, Benchmark::MeasureBest(repetitions,
+        [&]()
+        {
+            ownList.emplace(values.begin(), values.begin() + size / 2);
+            ownPieces.clear();
+            for(size_t piece = 0; piece < pieceCount; piece++)
+                ownPieces.emplace_back(values.begin(), values.begin() + pieceSize);
+        },
+        [&]()
+        {
+            for(List<T>& piece : ownPieces)
+                ownList->Splice(ownList->begin(), piece);
+        }));
+    Record(log, "splice", "std::list", type, pieceCount, Benchmark::MeasureBest(repetitions,
+        [&]()
+        {
+            stdList.emplace(values.begin(), values.begin() + size / 2);
+            stdPieces.clear();
+            for(size_t piece = 0; piece < pieceCount; piece++)
+                stdPieces.emplace_back(values.begin(), values.begin() + pieceSize);
+        },
+        [&]()
+        {
+            for(list<T>& piece : stdPieces)
+                stdList->splice(next(stdList->begin()), piece);
+        }));
+}
+
+// List::Sort is a selection sort, so it is measured on smaller inputs
+template<class T>
+static void RunListSortSuite(Benchmark::ResultLog& log, const size_t size)
+{
+    const char* type = TypeName<T>::value;
+
+    vector<T> values(size);
+    for(size_t index = 0; index < size; index++)
+        values[index] = MakeValue<T>(index);
+    shuffle(values.begin(), values.end(), mt19937(7));
+
+    optional<List<T>> ownList;
+    optional<list<T>> stdList;
+
+    Record(log, "sort", "List", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { ownList.emplace(values.begin(), values.end()); },
+        [&]() { ownList->Sort(); }));
+    Record(log, "sort", "std::list", type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { stdList.emplace(values.begin(), values.end()); },
+        [&]() { stdList->sort(); }));
+}
+
+template<class T>
+static void RunAllSuites(Benchmark::ResultLog& log)
+{
+    for(const size_t size : {1ul << 10, 1ul << 16, 1ul << 20})
+        RunArraySuite<T>(log, size);
+
+    for(const size_t size : {1ul << 10, 1ul << 14, 1ul << 17})
+        RunListSuite<T>(log, size);
+
+    for(const size_t size : {1ul << 8, 1ul << 10, 1ul << 12})
+        RunListSortSuite<T>(log, size);
+}
+
+int main(int argc, char const *argv[])
+{
+    const string path   = (argc > 1) ? argv[1] : "ContainerBenchmark.json";
+    const string label  = (argc > 2) ? argv[2] : "";
+
+    Benchmark::ResultLog log("ContainerBenchmark", label);
+
+    RunAllSuites<int>(log);
+    RunAllSuites<double>(log);
+    RunAllSuites<string>(log);
+
+    ofstream file(path);
+    log.WriteJson(file);
+
+    if(!file)
+    {
+        cerr << "Results cannot be written to " << path << endl;
+        return 1;
+    }
+
+    cout << log.GetResults().size() << " results written to " << path << endl;
+
+    return 0;
+}
@@ -0,0 +1,371 @@
+/** @file       ContainerTrace.h
+ *  @details    Tracing probes for the hot paths of the containers.
+ *              When CONTAINER_TRACING is defined, each probed operation records its name, the address
+ *              of the container, the size, the duration and the number of nodes visited into a ring
+ *              buffer owned by the calling thread. The rings can be dumped at any time from any thread.
+ *              Without the macro the probes expand to nothing.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Writers never block: each thread writes only its own ring and old records are overwritten.
+ *              Readers use a sequence number per slot, so a record being rewritten is skipped, not torn.
+ *  @note       Each ring takes ringCapacity * 64 bytes (256 KiB by default). Rings are only created for
+ *              threads recording concurrently: the ring of an exited thread is reused by the next thread,
+ *              so short lived workers do not grow the memory.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef CONTAINER_TRACE_H
+#define CONTAINER_TRACE_H
+
+#if defined(CONTAINER_TRACING)
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+namespace ContainerTrace {
+
+constexpr size_t ringCapacity = 4096;   // Records kept per thread, must be a power of two
+
+/**
+ * @brief   Copy of a trace record, as returned by Collect().
+ */
+struct Record{
+    const char* operation   = nullptr;  // Static name of the operation, e.g. "List::Find"
+    uintptr_t container     = 0;        // Address of the container, identifies the instance
+    uint64_t size           = 0;        // Number of elements when the operation started
+    uint64_t hops           = 0;        // Nodes visited, including the nested operations
+    uint64_t argument       = 0;        // Operation specific value, e.g. the index of a failed access
+    uint64_t startNs        = 0;        // Steady clock time of the start
+    uint64_t durationNs     = 0;        // Zero for instant events
+    uint32_t thread         = 0;        // Index of the ring, reused by a new thread after its thread exits
+};
+
+/**
+ * @brief   Single writer ring of records, one per thread.
+ */
+class Ring{
+public:
+    explicit Ring(const uint32_t thread) : thread(thread)
+    { /* Empty constructor */ }
+
+    void Write(const Record& record);               // Called by the owner thread only
+    void CollectInto(std::vector<Record>& output) const;    // Called by any thread
+
+private:
+    // Fields are relaxed atomics, so concurrent reads are not data races
+    struct Slot{
+        std::atomic<uint64_t> sequence{0};  // 2 * position + 1 while written, 2 * position + 2 when complete
+        std::atomic<const char*> operation{nullptr};
+        std::atomic<uint64_t> container{0}, size{0}, hops{0}, argument{0}, startNs{0}, durationNs{0};
+    };
+
+    const uint32_t thread;
+    std::atomic<uint64_t> head{0};      // Number of records written so far
+    Slot slots[ringCapacity];
+};
+
+/**
+ * @brief   Stores a record, overwriting the oldest one when the ring is full.
+ * @param   record  Record to be stored.
+ */
+inline void Ring::Write(const Record& record)
+{
+    const uint64_t position = head.load(std::memory_order_relaxed);
+    Slot& slot = slots[position & (ringCapacity - 1)];
+
+    slot.sequence.store(2 * position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);   // Readers see the odd sequence before any new field
+
+    slot.operation.store(record.operation, std::memory_order_relaxed);
+    slot.container.store(record.container, std::memory_order_relaxed);
+    slot.size.store(record.size, std::memory_order_relaxed);
+    slot.hops.store(record.hops, std::memory_order_relaxed);
+    slot.argument.store(record.argument, std::memory_order_relaxed);
+    slot.startNs.store(record.startNs, std::memory_order_relaxed);
+    slot.durationNs.store(record.durationNs, std::memory_order_relaxed);
+
+    slot.sequence.store(2 * position + 2, std::memory_order_release);
+    head.store(position + 1, std::memory_order_release);
+}
+
+/**
+ * @brief   Appends the complete records of the ring to the output, oldest first.
+ * @param   output  Destination vector.
+ */
+inline void Ring::CollectInto(std::vector<Record>& output) const
+{
+    const uint64_t end      = head.load(std::memory_order_acquire);
+    const uint64_t begin    = (end > ringCapacity) ? end - ringCapacity : 0;
+
+    for(uint64_t position = begin; position < end; position++)
+    {
+        const Slot& slot = slots[position & (ringCapacity - 1)];
+
+        const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if(before != 2 * position + 2)
+            continue;   // Overwritten by a newer record in the meantime
+
+        Record record;
+        record.operation    = slot.operation.load(std::memory_order_relaxed);
+        record.container    = slot.container.load(std::memory_order_relaxed);
+        record.size         = slot.size.load(std::memory_order_relaxed);
+        record.hops         = slot.hops.load(std::memory_order_relaxed);
+        record.argument     = slot.argument.load(std::memory_order_relaxed);
+        record.startNs      = slot.startNs.load(std::memory_order_relaxed);
+        record.durationNs   = slot.durationNs.load(std::memory_order_relaxed);
+        record.thread       = thread;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(slot.sequence.load(std::memory_order_relaxed) != before)
+            continue;   // Rewritten while being copied
+
+        output.push_back(record);
+    }
+}
+
+namespace Detail {
+
+/**
+ * @brief   Rings of all threads. They are kept after their threads exit, so late dumps still see them.
+ * @note    The ring of an exited thread goes to the free list, its records stay until the next owner overwrites them.
+ */
+struct Registry{
+    std::mutex lock;
+    std::vector<std::shared_ptr<Ring>> rings;
+    std::vector<std::shared_ptr<Ring>> freeRings;   // Rings of the exited threads, reused first
+    std::atomic<bool> enabled{true};
+};
+
+inline Registry registry;
+
+/**
+ * @brief   Ring owned by a thread, returned to the free list when the thread exits.
+ */
+class RingLease{
+public:
+    RingLease();
+    ~RingLease();
+
+    RingLease(const RingLease&) = delete;
+    RingLease& operator=(const RingLease&) = delete;
+
+    Ring* Get() const { return ring.get(); }
+
+private:
+    std::shared_ptr<Ring> ring;
+};
+
+// Set once the lease of the thread is destroyed, trivially destructible so it can be read during the thread exit
+inline thread_local bool ringReleased = false;
+
+inline RingLease::RingLease()
+{
+    std::lock_guard<std::mutex> guard(registry.lock);
+
+    if(registry.freeRings.empty() == false)
+    {
+        ring = registry.freeRings.back();
+        registry.freeRings.pop_back();
+    }
+    else
+    {
+        ring = std::make_shared<Ring>(static_cast<uint32_t>(registry.rings.size()));
+        registry.rings.push_back(ring);
+    }
+}
+
+inline RingLease::~RingLease()
+{
+    ringReleased = true;
+
+    std::lock_guard<std::mutex> guard(registry.lock);
+    registry.freeRings.push_back(ring);
+}
+
+class Scope;
+inline thread_local Scope* currentScope = nullptr;  // Innermost active scope of the thread
+
+/**
+ * @brief   Ring of the calling thread, taken from the free list or registered on the first use.
+ * @return  nullptr once the thread released its ring, the records of a thread being torn down are dropped.
+ */
+inline Ring* ThreadRing()
+{
+    if(ringReleased == true)
+        return nullptr;
+
+    thread_local RingLease lease;
+    return lease.Get();
+}
+
+inline uint64_t Now()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief   Measures an operation from its construction to its destruction.
+ * @note    Hops of nested scopes are added to the enclosing scope as well.
+ */
+class Scope{
+public:
+    Scope(const char* operation, const void* container, const size_t size)
+    : active(registry.enabled.load(std::memory_order_relaxed)), parent(currentScope)
+    {
+        record.operation    = operation;
+        record.container    = reinterpret_cast<uintptr_t>(container);
+        record.size         = size;
+        currentScope        = this;
+
+        if(active == true)
+            record.startNs = Now();
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    ~Scope()
+    {
+        currentScope = parent;
+
+        if(parent != nullptr)
+            parent->record.hops += record.hops;
+
+        if(active == true)
+        {
+            record.durationNs = Now() - record.startNs;
+
+            Ring* const ring = ThreadRing();
+            if(ring != nullptr)
+                ring->Write(record);
+        }
+    }
+
+    void AddHops(const uint64_t count) { record.hops += count; }
+
+private:
+    Record record;
+    const bool active;      // Tracing was enabled when the operation started
+    Scope* const parent;    // Enclosing scope, nullptr at the outermost level
+};
+
+} // namespace Detail
+
+/**
+ * @brief   Counts visited nodes for the innermost active scope of the thread.
+ * @param   count   Number of nodes.
+ */
+inline void AddHops(const uint64_t count = 1)
+{
+    if(Detail::currentScope != nullptr)
+        Detail::currentScope->AddHops(count);
+}
+
+/**
+ * @brief   Records an instant event, e.g. a failed access.
+ * @param   operation   Static name of the event.
+ * @param   container   Address of the container.
+ * @param   size        Number of elements of the container.
+ * @param   argument    Event specific value.
+ */
+inline void RecordEvent(const char* operation, const void* container, const size_t size, const uint64_t argument)
+{
+    if(Detail::registry.enabled.load(std::memory_order_relaxed) == false)
+        return;
+
+    Record record;
+    record.operation    = operation;
+    record.container    = reinterpret_cast<uintptr_t>(container);
+    record.size         = size;
+    record.argument     = argument;
+    record.startNs      = Detail::Now();
+
+    Ring* const ring = Detail::ThreadRing();
+    if(ring != nullptr)
+        ring->Write(record);
+}
+
+/**
+ * @brief   Turns the recording on or off at runtime, the probes stay compiled in.
+ * @param   enabled New state, tracing is enabled by default.
+ */
+inline void SetEnabled(const bool enabled)
+{
+    Detail::registry.enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Collects the records of all threads.
+ * @return  Records sorted by their start times.
+ */
+inline std::vector<Record> Collect()
+{
+    std::vector<std::shared_ptr<Ring>> rings;
+    {
+        std::lock_guard<std::mutex> guard(Detail::registry.lock);
+        rings = Detail::registry.rings;
+    }
+
+    std::vector<Record> records;
+    for(const std::shared_ptr<Ring>& ring : rings)
+        ring->CollectInto(records);
+
+    std::sort(records.begin(), records.end(), [](const Record& left, const Record& right)
+    { return left.startNs < right.startNs; });
+
+    return records;
+}
+
+/**
+ * @brief   Writes the records of all threads, one line per record.
+ * @param   stream  Destination stream.
+ */
+inline void Dump(std::ostream& stream)
+{
+    for(const Record& record : Collect())
+    {
+        stream << "thread="         << record.thread
+               << " op="            << record.operation
+               << " container=0x"   << std::hex << record.container << std::dec
+               << " size="          << record.size
+               << " hops="          << record.hops
+               << " arg="           << record.argument
+               << " start_ns="      << record.startNs
+               << " duration_ns="   << record.durationNs << '\n';
+    }
+
+    stream.flush();
+}
+
+} // namespace ContainerTrace
+
+// Measures the enclosing block, at most one per block
+#define CONTAINER_TRACE_SCOPE(operation, container, size) \
+    ContainerTrace::Detail::Scope containerTraceScope((operation), (container), (size))
+
+// Counts visited nodes for the innermost traced operation
+#define CONTAINER_TRACE_HOPS(count)     ContainerTrace::AddHops(count)
+
+// Records an instant event
+#define CONTAINER_TRACE_EVENT(operation, container, size, argument) \
+    ContainerTrace::RecordEvent((operation), (container), (size), (argument))
+
+#else
+
+#define CONTAINER_TRACE_SCOPE(operation, container, size)           ((void)0)
+#define CONTAINER_TRACE_HOPS(count)                                 ((void)0)
+#define CONTAINER_TRACE_EVENT(operation, container, size, argument) ((void)0)
+
+#endif
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,59 @@
+// Description: Tracing the hot paths of List and Array and dumping the per-thread trace rings
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread ContainerTracing.cpp -o ContainerTracing
+// Usage:       ./ContainerTracing
+
+// Probes compile to nothing unless tracing is enabled before any inclusion
+#define CONTAINER_TRACING
+
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <numeric>
+#include <stdexcept>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+
+using namespace std;
+
+// Runs a few traced operations on its own lists
+static void Worker(const int seed)
+{
+    vector<int> values(1000);
+    iota(values.begin(), values.end(), seed);
+
+    List<int> list(values.rbegin(), values.rend());
+    list.ReplaceFirstWith(seed + 500, -1);                  // Traced as List::Find
+    list.RemoveIf([](int value) { return value % 3 == 0; });
+    list.Sort();
+
+    List<int> other{seed, seed + 2000, seed + 4000};
+    list.Merge(other);
+}
+
+int main()
+{
+    thread first(Worker, 0), second(Worker, 10000);
+    first.join();
+    second.join();
+
+    Array<int> array{1, 2, 3};
+    try
+    {
+        cout << array[5] << endl;
+    }
+    catch(const range_error& error)
+    {
+        cout << "Caught: " << error.what() << endl;
+    }
+
+    // Recording can be paused, e.g. while dumping
+    ContainerTrace::SetEnabled(false);
+    cout << "Trace dump:" << endl;
+    ContainerTrace::Dump(cout);
+
+    return 0;
+}
@@ -0,0 +1,76 @@
+// Description: Destruction time of large List and Array instances with and without the deferred reclaimer
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread DeferredDestruction.cpp -o DeferredDestruction
+// Usage:       ./DeferredDestruction [list nodes] [array elements]
+//              (defaults: 5000000 and 50000000)
+
+// Destructors hand large containers to the background reclaimer, must be defined before any inclusion
+#define CONTAINER_DEFERRED_RECLAMATION
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstdlib>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "Benchmark.h"
+
+using namespace std;
+using Benchmark::Stopwatch;
+
+// Measures how long the calling thread is blocked by the destructor of a freshly built container
+template<class ContainerType, class BuilderType>
+static double DestructionMilliseconds(BuilderType build)
+{
+    ContainerType* container = build();
+
+    Stopwatch watch;
+    delete container;
+    return watch.ElapsedSeconds() * 1000;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t listNodes      = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 5000000;
+    const size_t arrayElements  = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 50000000;
+
+    DeferredReclaimer& reclaimer = DeferredReclaimer::Global();
+
+    auto buildIntList = [&]() { return new List<int>(listNodes, 7); };
+    auto buildStringList = [&]() { return new List<string>(listNodes / 4, string(40, 'x')); };  // Non-trivial destructor
+    auto buildArray = [&]() { Array<long>* array = new Array<long>(arrayElements); fill(array->begin(), array->end(), 1); return array; };
+
+    cout << fixed << setprecision(2)
+         << "Caller-side destruction time (ms), threshold " << reclaimer.GetThreshold() << " bytes" << endl
+         << setw(28) << "" << setw(12) << "inline" << setw(12) << "deferred" << endl;
+
+    reclaimer.SetEnabled(false);
+    const double listInline     = DestructionMilliseconds<List<int>>(buildIntList);
+    const double stringsInline  = DestructionMilliseconds<List<string>>(buildStringList);
+    const double arrayInline    = DestructionMilliseconds<Array<long>>(buildArray);
+
+    reclaimer.SetEnabled(true);
+    const double listDeferred       = DestructionMilliseconds<List<int>>(buildIntList);
+    const double stringsDeferred    = DestructionMilliseconds<List<string>>(buildStringList);
+    const double arrayDeferred      = DestructionMilliseconds<Array<long>>(buildArray);
+
+    cout << setw(28) << left << ("List<int> x " + to_string(listNodes)) << right
+         << setw(12) << listInline << setw(12) << listDeferred << endl
+         << setw(28) << left << ("List<string> x " + to_string(listNodes / 4)) << right
+         << setw(12) << stringsInline << setw(12) << stringsDeferred << endl
+         << setw(28) << left << ("Array<long> x " + to_string(arrayElements)) << right
+         << setw(12) << arrayInline << setw(12) << arrayDeferred << endl;
+
+    // Small containers stay below the threshold and are destroyed inline
+    {
+        List<int> small{1, 2, 3};
+    }
+
+    reclaimer.Flush();
+    cout << "Reclaimer: " << reclaimer.GetStatistics().ToText() << endl;
+
+    return 0;
+}
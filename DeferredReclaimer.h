@@ -0,0 +1,265 @@
+/** @file       DeferredReclaimer.h
+ *  @details    Background reclamation of large memory blocks and node chains.
+ *              Destroying a huge container frees every node or unmaps many pages, which can stall the
+ *              calling thread for seconds. The reclaimer takes the ownership of the memory in O(1)
+ *              and a background thread destroys and frees it later.
+ *              When CONTAINER_DEFERRED_RECLAMATION is defined, the destructors of List and Array hand
+ *              their memory to the global reclaimer if it is larger than the configured threshold.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       The queue is bounded. When it is full the caller reclaims the memory itself, so the
+ *              pending memory cannot grow without limit.
+ *  @note       Link with -pthread.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef DEFERRED_RECLAIMER_H
+#define DEFERRED_RECLAIMER_H
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <atomic>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief   Counters of a reclaimer.
+ */
+struct ReclaimerStatistics{
+    uint64_t deferred           = 0;    // Jobs accepted into the queue
+    uint64_t fallbacks          = 0;    // Jobs reclaimed by the caller because the queue was full
+    uint64_t reclaimed          = 0;    // Jobs completed by the background thread
+    uint64_t elementsReclaimed  = 0;    // Elements destroyed by the background thread
+    uint64_t bytesReclaimed     = 0;    // Bytes freed by the background thread
+    size_t pendingJobs          = 0;    // Jobs waiting in the queue or being reclaimed
+    size_t pendingBytes         = 0;    // Bytes of the pending jobs
+    size_t peakPendingJobs      = 0;    // Highest value of pendingJobs
+    double busySeconds          = 0;    // Time spent reclaiming by the background thread
+
+    std::string ToText() const;         // Single line of key=value pairs
+};
+
+/**
+ * @brief   Formats the counters as a log friendly line.
+ * @return  Text of the form "deferred=... fallbacks=... ...".
+ */
+inline std::string ReclaimerStatistics::ToText() const
+{
+    std::ostringstream text;
+    text << "deferred="             << deferred
+         << " fallbacks="           << fallbacks
+         << " reclaimed="           << reclaimed
+         << " elements_reclaimed="  << elementsReclaimed
+         << " bytes_reclaimed="     << bytesReclaimed
+         << " pending_jobs="        << pendingJobs
+         << " pending_bytes="       << pendingBytes
+         << " peak_pending_jobs="   << peakPendingJobs
+         << " busy_s="              << std::fixed << std::setprecision(3) << busySeconds;
+
+    return text.str();
+}
+
+/**
+ * @brief   Bounded queue of reclamation jobs served by a background thread.
+ * @note    A job is a plain function pointer with its resource, so deferring never allocates.
+ */
+class DeferredReclaimer{
+public:
+    using ReclaimFunction = void (*)(void* resource, size_t count);     // Destroys and frees the resource
+
+    explicit DeferredReclaimer(const size_t capacity = 256, const size_t thresholdBytes = 1 << 20);
+    ~DeferredReclaimer();   // Reclaims the pending jobs, then stops the thread
+
+    DeferredReclaimer(const DeferredReclaimer&) = delete;
+    DeferredReclaimer& operator=(const DeferredReclaimer&) = delete;
+
+    static DeferredReclaimer& Global();     // Shared by the containers, never destroyed
+
+    bool Defer(ReclaimFunction reclaim, void* resource, const size_t count, const size_t bytes);
+    void Flush();                           // Waits until all jobs deferred before the call are reclaimed
+
+    void SetThreshold(const size_t bytes)   { thresholdBytes.store(bytes, std::memory_order_relaxed); }
+    size_t GetThreshold() const             { return thresholdBytes.load(std::memory_order_relaxed); }
+    void SetEnabled(const bool enabled)     { this->enabled.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const                  { return enabled.load(std::memory_order_relaxed); }
+
+    ReclaimerStatistics GetStatistics() const;
+
+private:
+    struct Job{
+        ReclaimFunction reclaim = nullptr;
+        void* resource          = nullptr;
+        size_t count            = 0;
+        size_t bytes            = 0;
+    };
+
+    void Run();     // Background thread body
+
+    std::vector<Job> jobs;          // Ring buffer of the pending jobs
+    size_t head = 0;                // Index of the oldest pending job
+    size_t size = 0;                // Number of queued jobs
+    bool busy   = false;            // Background thread is reclaiming a job
+    bool stopRequested = false;
+
+    std::atomic<size_t> thresholdBytes;
+    std::atomic<bool> enabled{true};
+
+    mutable std::mutex lock;
+    std::condition_variable wakeCondition;      // Wakes the background thread
+    std::condition_variable idleCondition;      // Wakes the flushing callers
+
+    ReclaimerStatistics statistics;             // Guarded by the lock
+
+    std::thread reclaimer;          // Declared last, starts after the other members
+};
+
+/**
+ * @brief   Constructs the reclaimer and starts its thread.
+ * @param   capacity        Maximum number of queued jobs.
+ * @param   thresholdBytes  Smaller resources are reclaimed by the caller, deferring them costs more than it saves.
+ * @throws  std::logic_error If the capacity is zero.
+ */
+inline DeferredReclaimer::DeferredReclaimer(const size_t capacity, const size_t thresholdBytes)
+: jobs(capacity), thresholdBytes(thresholdBytes)
+{
+    if(capacity == 0)
+        throw std::logic_error("Reclaimer capacity cannot be zero!");
+
+    reclaimer = std::thread(&DeferredReclaimer::Run, this);
+}
+
+/**
+ * @brief   Reclaims the pending jobs and joins the thread.
+ */
+inline DeferredReclaimer::~DeferredReclaimer()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopRequested = true;
+    }
+
+    wakeCondition.notify_one();
+    reclaimer.join();
+}
+
+/**
+ * @brief   Reclaimer used by the containers.
+ * @note    Intentionally leaked, so containers destroyed during the static destruction can still use it.
+ *          Jobs pending at exit are released by the operating system.
+ */
+inline DeferredReclaimer& DeferredReclaimer::Global()
+{
+    static DeferredReclaimer* const instance = new DeferredReclaimer();
+    return *instance;
+}
+
+/**
+ * @brief   Hands a resource to the background thread.
+ * @param   reclaim     Function destroying and freeing the resource.
+ * @param   resource    Memory to be reclaimed, e.g. the first node of a chain.
+ * @param   count       Number of elements, passed to the function.
+ * @param   bytes       Size of the resource, used by the threshold and the statistics.
+ * @return  true    If the job was queued, the reclaimer owns the resource.
+ *          false   If the resource is below the threshold, the reclaimer is disabled or the queue is full.
+ *                  The caller keeps the ownership and must reclaim it.
+ */
+inline bool DeferredReclaimer::Defer(ReclaimFunction reclaim, void* resource, const size_t count, const size_t bytes)
+{
+    if((resource == nullptr) || (IsEnabled() == false) || (bytes < GetThreshold()))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        if((size == jobs.size()) || (stopRequested == true))
+        {
+            statistics.fallbacks++;
+            return false;
+        }
+
+        Job& job        = jobs[(head + size) % jobs.size()];
+        job.reclaim     = reclaim;
+        job.resource    = resource;
+        job.count       = count;
+        job.bytes       = bytes;
+        size++;
+
+        statistics.deferred++;
+        statistics.pendingJobs++;
+        statistics.pendingBytes += bytes;
+        statistics.peakPendingJobs = (statistics.pendingJobs > statistics.peakPendingJobs) ? statistics.pendingJobs : statistics.peakPendingJobs;
+    }
+
+    wakeCondition.notify_one();
+    return true;
+}
+
+/**
+ * @brief   Waits until the queue is empty and the background thread is idle.
+ */
+inline void DeferredReclaimer::Flush()
+{
+    std::unique_lock<std::mutex> guard(lock);
+    idleCondition.wait(guard, [this]() { return (size == 0) && (busy == false); });
+}
+
+/**
+ * @brief   Takes a snapshot of the counters.
+ * @return  Counter values.
+ */
+inline ReclaimerStatistics DeferredReclaimer::GetStatistics() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return statistics;
+}
+
+/**
+ * @brief   Reclaims the queued jobs one by one, outside of the lock.
+ */
+inline void DeferredReclaimer::Run()
+{
+    std::unique_lock<std::mutex> guard(lock);
+
+    while(true)
+    {
+        wakeCondition.wait(guard, [this]() { return (size != 0) || (stopRequested == true); });
+
+        if(size == 0)   // Stop requested and nothing left
+            break;
+
+        const Job job = jobs[head];
+        head = (head + 1) % jobs.size();
+        size--;
+        busy = true;
+
+        guard.unlock();
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        job.reclaim(job.resource, job.count);
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        guard.lock();
+
+        busy = false;
+        statistics.reclaimed++;
+        statistics.elementsReclaimed    += job.count;
+        statistics.bytesReclaimed       += job.bytes;
+        statistics.pendingJobs--;
+        statistics.pendingBytes         -= job.bytes;
+        statistics.busySeconds          += elapsed;
+
+        if(size == 0)
+            idleCondition.notify_all();
+    }
+
+    idleCondition.notify_all();
+}
+
+#endif  // Prevent recursive inclusion
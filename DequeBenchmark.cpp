@@ -0,0 +1,202 @@
+// Description: Queue and stack workloads of Deque against List and std::deque, results written as JSON
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 DequeBenchmark.cpp -o DequeBenchmark
+// Usage:       ./DequeBenchmark [outputPath] [label]
+//              (defaults: DequeBenchmark.json and an empty label)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <optional>
+#include <cstdio>
+
+#include "Benchmark.h"
+#include "DequeContainer.h"
+#include "ListContainer.h"
+
+using namespace std;
+
+static const size_t repetitions = 5;
+
+// Names written into the results
+template<class T> struct TypeName;
+template<> struct TypeName<int>     { static constexpr const char* value = "int";           };
+template<> struct TypeName<string>  { static constexpr const char* value = "std::string";   };
+
+template<class T> T MakeValue(const size_t index);
+template<> int MakeValue<int>(const size_t index) { return static_cast<int>(index); }
+template<> string MakeValue<string>(const size_t index)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "item%010zu", index);  // Long enough to defeat the small string optimization
+    return text;
+}
+
+// Cheap reduction used to consume the elements
+template<class T>
+static size_t Weight(const T& value)
+{
+    if constexpr(is_arithmetic<T>::value)
+        return static_cast<size_t>(value);
+    else
+        return value.size();
+}
+
+// Adapters giving the three containers the same vocabulary
+template<class T> void PushBack(List<T>& list, const T& value)      { list.Append(value);       }
+template<class T> void PushBack(Deque<T>& deque, const T& value)    { deque.Append(value);      }
+template<class T> void PushBack(deque<T>& deque, const T& value)    { deque.push_back(value);   }
+template<class T> void PopFront(List<T>& list)      { list.RemoveFirst();   }
+template<class T> void PopFront(Deque<T>& deque)    { deque.RemoveFirst();  }
+template<class T> void PopFront(deque<T>& deque)    { deque.pop_front();    }
+template<class T> void PopBack(List<T>& list)       { list.RemoveLast();    }
+template<class T> void PopBack(Deque<T>& deque)     { deque.RemoveLast();   }
+template<class T> void PopBack(deque<T>& deque)     { deque.pop_back();     }
+template<class T> const T& Front(List<T>& list)     { return list.First();  }
+template<class T> const T& Front(Deque<T>& deque)   { return deque.First(); }
+template<class T> const T& Front(deque<T>& deque)   { return deque.front(); }
+template<class T> const T& Back(List<T>& list)      { return list.Last();   }
+template<class T> const T& Back(Deque<T>& deque)    { return deque.Last();  }
+template<class T> const T& Back(deque<T>& deque)    { return deque.back();  }
+
+// Sums the elements, List's end() points to the last element so it is walked by its node count
+template<class T>
+static size_t Traverse(List<T>& list)
+{
+    size_t sum = 0;
+    auto it = list.begin();
+
+    for(size_t index = 0; index < list.GetNodeCount(); index++, it++)
+        sum += Weight(*it);
+
+    return sum;
+}
+
+template<class ContainerType>
+static size_t Traverse(ContainerType& container)
+{
+    size_t sum = 0;
+
+    for(const auto& value : container)
+        sum += Weight(value);
+
+    return sum;
+}
+
+// Stores the result and prints a table row
+static void Record(Benchmark::ResultLog& log, const string& operation, const string& container,
+                   const char* elementType, const size_t size, const double seconds)
+{
+    Benchmark::Result result;
+    result.operation    = operation;
+    result.container    = container;
+    result.elementType  = elementType;
+    result.size         = size;
+    result.seconds      = seconds;
+    log.Add(result);
+
+    cout << setw(14) << left << operation << setw(13) << container << setw(13) << elementType << right
+         << setw(10) << size << setw(14) << fixed << setprecision(3) << result.NanosecondsPerElement() << " ns/elem" << endl;
+}
+
+template<class ContainerType, class T>
+static void RunSuite(Benchmark::ResultLog& log, const char* name, const vector<T>& values)
+{
+    const char* type    = TypeName<T>::value;
+    const size_t size   = values.size();
+    const size_t window = 1024;     // Queue length kept by the steady state workload
+
+    optional<ContainerType> container;
+
+    // Queue: the elements enter at the back and leave at the front
+    Record(log, "queue", name, type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { container.emplace(); },
+        [&]()
+        {
+            size_t sum = 0;
+
+            for(size_t index = 0; index < size; index++)
+            {
+                PushBack(*container, values[index]);
+
+                if(index >= window)     // Keeps a bounded queue which slides along
+                {
+                    sum += Weight(Front(*container));
+                    PopFront(*container);
+                }
+            }
+
+            Benchmark::DoNotOptimize(sum);
+        }));
+
+    // Stack: fill, then drain from the back
+    Record(log, "stack", name, type, size, Benchmark::MeasureBest(repetitions,
+        [&]() { container.emplace(); },
+        [&]()
+        {
+            size_t sum = 0;
+
+            for(const T& value : values)
+                PushBack(*container, value);
+
+            for(size_t index = 0; index < size; index++)
+            {
+                sum += Weight(Back(*container));
+                PopBack(*container);
+            }
+
+            Benchmark::DoNotOptimize(sum);
+        }));
+
+    container.emplace();
+    for(const T& value : values)
+        PushBack(*container, value);
+
+    Record(log, "traverse", name, type, size, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        Benchmark::DoNotOptimize(Traverse(*container));
+    }));
+}
+
+template<class T>
+static void RunAllSuites(Benchmark::ResultLog& log)
+{
+    for(const size_t size : {1ul << 12, 1ul << 16, 1ul << 20})
+    {
+        vector<T> values(size);
+        for(size_t index = 0; index < size; index++)
+            values[index] = MakeValue<T>(index);
+
+        RunSuite<List<T>>(log, "List", values);
+        RunSuite<Deque<T>>(log, "Deque", values);
+        RunSuite<deque<T>>(log, "std::deque", values);
+    }
+}
+
+int main(int argc, char const *argv[])
+{
+    const string path   = (argc > 1) ? argv[1] : "DequeBenchmark.json";
+    const string label  = (argc > 2) ? argv[2] : "";
+
+    Benchmark::ResultLog log("DequeBenchmark", label);
+
+    RunAllSuites<int>(log);
+    RunAllSuites<string>(log);
+
+    ofstream file(path);
+    log.WriteJson(file);
+
+    if(!file)
+    {
+        cerr << "Results cannot be written to " << path << endl;
+        return 1;
+    }
+
+    cout << log.GetResults().size() << " results written to " << path << endl;
+    return 0;
+}
@@ -0,0 +1,764 @@
+/** @file       DequeContainer.h
+ *  @details    A template double ended queue built from fixed-size Array chunks.
+ *              A map of chunk pointers grows at both ends, so appending and prepending are O(1) and
+ *              the elements are reached in O(1) by their index. Neighbouring elements share a chunk,
+ *              which keeps the iteration cache friendly unlike the node per element of List.
+ *              The interface follows the vocabulary of List.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       The chunks are Array instances, so the element type must be default constructible and assignable.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef DEQUE_CONTAINER_H
+#define DEQUE_CONTAINER_H
+
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <cstddef>
+
+#include "ArrayContainer.h"
+
+/**
+ * @brief   Determines the chunk capacity of a deque from the size of its element.
+ * @param   elementSize Size of the element in bytes
+ * @return  Largest power of two whose elements fit into 4KiB, at least 16.
+ * @note    A power of two turns the index arithmetic into shifts and masks.
+ */
+constexpr size_t DequeChunkCapacity(const size_t elementSize)
+{
+    size_t capacity = 16;
+
+    while(capacity * 2 * elementSize <= 4096)
+        capacity *= 2;
+
+    return capacity;
+}
+
+template<class T>
+class Deque{
+public:
+    class iterator; // Forward declaration
+
+    /*** Constructors and Destructors ***/
+    Deque();                                            // Default constructor
+    Deque(const Deque<T>& anotherDeque);                // Copy constructor
+    Deque(Deque<T>&& anotherDeque);                     // Move constructor
+    Deque(std::initializer_list<T> initializerList);    // Initializer list constructor
+
+    virtual ~Deque();   // Destructor
+
+    const Deque<T>& operator=(const Deque<T>& rightDeque);  // Deque assignment
+
+    /*** Element Access ***/
+    const T& First() const; // Get the first data as an rValue
+    const T& Last() const;  // Get the last data as an rValue
+    T& First();             // Get the first data as an lValue
+    T& Last();              // Get the last data as an lValue
+
+    const T& operator[](const size_t index) const;  // Subscript operator for const objects returns rValue
+    T& operator[](const size_t index);              // Subscript operator for non-const objects returns lValue
+
+    /*** Modifiers ***/
+    Deque<T>& Append(const T& data);    // Add after the last element
+    Deque<T>& Prepend(const T& data);   // Add before the first element
+
+    template <class... Args>
+    Deque<T>& EmplaceAppend(Args&&... args);    // Constructs the element from the arguments
+    template <class... Args>
+    Deque<T>& EmplacePrepend(Args&&... args);   // Constructs the element from the arguments
+
+    Deque<T>& RemoveFirst();    // Remove the first element
+    Deque<T>& RemoveLast();     // Remove the last element
+    Deque<T>& EraseAll();       // Remove all elements and release the chunks
+
+    /*** Operations ***/
+    void Swap(Deque<T>& anotherDeque);          // Exchanges the content of the deque by the content of another deque
+    void PrintAll(std::ostream& stream) const;  // Prints all elements by inserting to the given stream
+
+    /*** Status Checkers ***/
+    bool isEmpty() const        { return (numberOfElements == 0);   }
+    size_t getSize() const      { return numberOfElements;          }
+    static constexpr size_t GetChunkCapacity() { return chunkCapacity; }   // Elements per chunk
+
+    /* Declaring a function as a friend inside of a template class
+       corrupts the template usage. You may want to check the holy StackOverflow :)
+       stackoverflow.com/questions/4660123 */
+    template<class _T>
+    friend std::ostream& operator<<(std::ostream& stream, const Deque<_T>& deque);
+
+    /*** Iterators ***/
+    // Unlike List, end() points past the last element as in the standard library
+    class iterator{
+        friend class Deque;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        iterator() = default;
+
+        iterator& operator++()      // Prefix increment, steps into the next chunk at the end of the current one
+        {
+            if((++current == chunkEnd) && (chunk != lastChunk))
+            {
+                SetChunk(chunk + 1);
+                current = chunkBegin;
+            }
+
+            return *this;
+        }
+
+        iterator& operator--()      // Prefix decrement, steps into the previous chunk at the beginning of the current one
+        {
+            if(current == chunkBegin)
+            {
+                SetChunk(chunk - 1);
+                current = chunkEnd;
+            }
+
+            --current;
+            return *this;
+        }
+
+        iterator operator++(int)    { iterator previous = *this; ++(*this); return previous; }  // Postfix increment
+        iterator operator--(int)    { iterator previous = *this; --(*this); return previous; }  // Postfix decrement
+
+        T& operator*() const    { return *current;  }   // Dereference operator
+        T* operator->() const   { return current;   }   // Member access operator
+        bool operator==(const iterator& anotherIt) const { return (current == anotherIt.current) && (chunk == anotherIt.chunk); }
+        bool operator!=(const iterator& anotherIt) const { return !operator==(anotherIt); }
+
+    private:
+        iterator(Array<T>** chunk, Array<T>** lastChunk, const size_t offset)
+        : chunk(chunk), lastChunk(lastChunk)
+        { SetChunk(chunk); current = chunkBegin + offset; }
+
+        void SetChunk(Array<T>** newChunk)
+        {
+            chunk       = newChunk;
+            chunkBegin  = (*newChunk)->begin();
+            chunkEnd    = (*newChunk)->end();
+        }
+
+        T* current          = nullptr;  // Element pointed to
+        T* chunkBegin       = nullptr;  // Elements of the current chunk
+        T* chunkEnd         = nullptr;
+        Array<T>** chunk    = nullptr;  // Entry of the current chunk in the map
+        Array<T>** lastChunk = nullptr; // Entry of the last chunk in use, the iteration stops there
+    };
+
+    iterator begin();   // Returns an iterator pointing to the first element
+    iterator end();     // Returns an iterator pointing past the last element
+
+private:
+    /*** Chunk Management ***/
+    static constexpr size_t chunkCapacity = DequeChunkCapacity(sizeof(T));
+    static constexpr size_t chunkMask     = chunkCapacity - 1;
+
+    T& At(const size_t index) const;            // Unchecked access by the position from the first element
+    void ThrowOutOfRange(const size_t index) const;
+    static void ResetSlot(T& slot);             // Releases the resources of a removed element
+    Array<T>* AcquireChunk();                   // Reuses the spare chunk if there is one
+    void ReleaseChunk(Array<T>* chunk);         // Keeps one chunk as spare, frees the others
+    void ReserveChunkAtFront();                 // Makes room in the map for one more chunk before the first one
+    void ReserveChunkAtBack();                  // Makes room in the map for one more chunk after the last one
+    void RebuildMap(const bool roomAtFront);    // Centers the chunks in the map, growing it if it is half full
+    void ReleaseAll();                          // Frees the chunks and the map
+
+    /*** Members ***/
+    Array<T>** chunkMap     = nullptr;  // Chunk pointers, the used ones are contiguous
+    size_t mapCapacity      = 0;        // Number of entries in the map
+    size_t firstChunk       = 0;        // Map entry of the chunk holding the first element
+    size_t chunkCount       = 0;        // Chunks in use, starting from firstChunk
+    size_t firstOffset      = 0;        // Position of the first element in its chunk
+    size_t numberOfElements = 0;        // Element count
+    Array<T>* spareChunk    = nullptr;  // Last released chunk, saves an allocation when a queue crosses chunks
+};
+
+
+/**
+ * @brief   Default constructor, no chunk is allocated until the first insertion.
+ */
+template<class T>
+Deque<T>::Deque()
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Copy constructor
+ * @param   anotherDeque    Source deque
+ */
+template<class T>
+Deque<T>::Deque(const Deque<T>& anotherDeque)
+{
+    try
+    {
+        for(size_t index = 0; index < anotherDeque.getSize(); index++)
+            Append(anotherDeque.At(index));
+    }
+    catch(...)
+    {
+        ReleaseAll();   // The destructor won't run for a partially constructed deque
+        throw;
+    }
+}
+
+/**
+ * @brief   Move constructor, takes over the chunks of the source deque.
+ * @param   anotherDeque    Source deque, left empty
+ */
+template<class T>
+Deque<T>::Deque(Deque<T>&& anotherDeque)
+{
+    Swap(anotherDeque);
+}
+
+/**
+ * @brief   Constructs by copying the elements of the initializer list.
+ * @param   initializerList Source elements
+ */
+template<class T>
+Deque<T>::Deque(std::initializer_list<T> initializerList)
+{
+    try
+    {
+        for(const T& data : initializerList)
+            Append(data);
+    }
+    catch(...)
+    {
+        ReleaseAll();
+        throw;
+    }
+}
+
+/**
+ * @brief   Destructor
+ */
+template<class T>
+Deque<T>::~Deque()
+{
+    ReleaseAll();
+}
+
+/**
+ * @brief   Replaces the content by a copy of another deque.
+ * @param   rightDeque  Source deque
+ * @return  rValue reference to the current deque to support cascaded assignments
+ * @note    The content is left untouched if the copy throws.
+ */
+template<class T>
+const Deque<T>& Deque<T>::operator=(const Deque<T>& rightDeque)
+{
+    if(this != &rightDeque)
+    {
+        Deque<T> copy(rightDeque);
+        Swap(copy);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Access to the first element.
+ * @return  rValue reference to the first element.
+ * @throws  std::logic_error If the deque is empty
+ */
+template<class T>
+const T& Deque<T>::First() const
+{
+    if(isEmpty() == true)
+        throw std::logic_error("Deque is empty!");
+
+    return At(0);
+}
+
+/**
+ * @brief   Access to the last element.
+ * @return  rValue reference to the last element.
+ * @throws  std::logic_error If the deque is empty
+ */
+template<class T>
+const T& Deque<T>::Last() const
+{
+    if(isEmpty() == true)
+        throw std::logic_error("Deque is empty!");
+
+    return At(numberOfElements - 1);
+}
+
+/**
+ * @brief   Access to the first element.
+ * @return  lValue reference to the first element.
+ * @throws  std::logic_error If the deque is empty
+ */
+template<class T>
+T& Deque<T>::First()
+{
+    if(isEmpty() == true)
+        throw std::logic_error("Deque is empty!");
+
+    return At(0);
+}
+
+/**
+ * @brief   Access to the last element.
+ * @return  lValue reference to the last element.
+ * @throws  std::logic_error If the deque is empty
+ */
+template<class T>
+T& Deque<T>::Last()
+{
+    if(isEmpty() == true)
+        throw std::logic_error("Deque is empty!");
+
+    return At(numberOfElements - 1);
+}
+
+/**
+ * @brief   Subscript operator for rValue return
+ * @param   index   Position of the element, counted from the first one
+ * @return  rValue reference to the data at given index
+ * @throws  std::range_error When given index is out of deque range
+ */
+template<class T>
+const T& Deque<T>::operator[](const size_t index) const
+{
+    if(index >= numberOfElements)   // Check for out-of-range random access
+        ThrowOutOfRange(index);
+
+    return At(index);
+}
+
+/**
+ * @brief   Subscript operator for lValue return
+ * @param   index   Position of the element, counted from the first one
+ * @return  lValue reference to the data at given index
+ * @throws  std::range_error When given index is out of deque range
+ */
+template<class T>
+T& Deque<T>::operator[](const size_t index)
+{
+    if(index >= numberOfElements)   // Check for out-of-range random access
+        ThrowOutOfRange(index);
+
+    return At(index);
+}
+
+/**
+ * @brief   Adds a copy of the data after the last element.
+ * @param   data    Element to be added
+ * @return  lValue reference to the current deque to support cascaded calls
+ */
+template<class T>
+Deque<T>& Deque<T>::Append(const T& data)
+{
+    return EmplaceAppend(data);
+}
+
+/**
+ * @brief   Adds a copy of the data before the first element.
+ * @param   data    Element to be added
+ * @return  lValue reference to the current deque to support cascaded calls
+ */
+template<class T>
+Deque<T>& Deque<T>::Prepend(const T& data)
+{
+    return EmplacePrepend(data);
+}
+
+/**
+ * @brief   Adds an element after the last one.
+ * @param   args    Arguments passed to the constructor of the element
+ * @return  lValue reference to the current deque to support cascaded calls
+ * @note    The chunk slots are already constructed, the new element is move assigned into its slot.
+ */
+template<class T>
+template <class... Args>
+Deque<T>& Deque<T>::EmplaceAppend(Args&&... args)
+{
+    T data(std::forward<Args>(args)...);    // Constructed first, so a throwing constructor leaves the deque untouched
+
+    if(firstOffset + numberOfElements == chunkCount * chunkCapacity)    // The last chunk is full or there is no chunk at all
+    {
+        ReserveChunkAtBack();
+        chunkMap[firstChunk + chunkCount] = AcquireChunk();
+        chunkCount++;
+    }
+
+    numberOfElements++;
+    At(numberOfElements - 1) = std::move(data);
+
+    return *this;
+}
+
+/**
+ * @brief   Adds an element before the first one.
+ * @param   args    Arguments passed to the constructor of the element
+ * @return  lValue reference to the current deque to support cascaded calls
+ * @note    The chunk slots are already constructed, the new element is move assigned into its slot.
+ */
+template<class T>
+template <class... Args>
+Deque<T>& Deque<T>::EmplacePrepend(Args&&... args)
+{
+    T data(std::forward<Args>(args)...);    // Constructed first, so a throwing constructor leaves the deque untouched
+
+    if(firstOffset == 0)    // The first chunk is full or there is no chunk at all
+    {
+        ReserveChunkAtFront();
+        firstChunk--;
+        chunkMap[firstChunk] = AcquireChunk();
+        chunkCount++;
+        firstOffset = chunkCapacity;
+    }
+
+    firstOffset--;
+    numberOfElements++;
+    At(0) = std::move(data);
+
+    return *this;
+}
+
+/**
+ * @brief   Removes the first element, its chunk is released when it becomes empty.
+ * @return  lValue reference to the current deque to support cascaded remove calls
+ */
+template<class T>
+Deque<T>& Deque<T>::RemoveFirst()
+{
+    if(isEmpty() == true)
+        return *this;
+
+    ResetSlot(At(0));
+    firstOffset++;
+    numberOfElements--;
+
+    if(numberOfElements == 0)
+    {
+        ReleaseChunk(chunkMap[firstChunk]);
+        chunkMap[firstChunk] = nullptr;
+        chunkCount  = 0;
+        firstOffset = 0;
+    }
+    else if(firstOffset == chunkCapacity)   // Left the first chunk
+    {
+        ReleaseChunk(chunkMap[firstChunk]);
+        chunkMap[firstChunk] = nullptr;
+        firstChunk++;
+        chunkCount--;
+        firstOffset = 0;
+    }
+    else;
+
+    return *this;
+}
+
+/**
+ * @brief   Removes the last element, its chunk is released when it becomes empty.
+ * @return  lValue reference to the current deque to support cascaded remove calls
+ */
+template<class T>
+Deque<T>& Deque<T>::RemoveLast()
+{
+    if(isEmpty() == true)
+        return *this;
+
+    ResetSlot(At(numberOfElements - 1));
+    numberOfElements--;
+
+    const size_t position = firstOffset + numberOfElements;     // Slot right after the new last element
+
+    if(numberOfElements == 0)
+    {
+        ReleaseChunk(chunkMap[firstChunk]);
+        chunkMap[firstChunk] = nullptr;
+        chunkCount  = 0;
+        firstOffset = 0;
+    }
+    else if(position == (chunkCount - 1) * chunkCapacity)   // The last chunk became empty
+    {
+        chunkCount--;
+        ReleaseChunk(chunkMap[firstChunk + chunkCount]);
+        chunkMap[firstChunk + chunkCount] = nullptr;
+    }
+    else;
+
+    return *this;
+}
+
+/**
+ * @brief   Removes all elements and frees all chunks, including the spare one.
+ * @return  lValue reference to the current deque to support cascaded calls
+ * @note    The map is kept for the next insertions.
+ */
+template<class T>
+Deque<T>& Deque<T>::EraseAll()
+{
+    for(size_t index = 0; index < chunkCount; index++)
+    {
+        delete chunkMap[firstChunk + index];
+        chunkMap[firstChunk + index] = nullptr;
+    }
+
+    delete spareChunk;
+    spareChunk = nullptr;
+
+    chunkCount          = 0;
+    firstOffset         = 0;
+    numberOfElements    = 0;
+
+    return *this;
+}
+
+/**
+ * @brief   Exchanges the content of two deques, no element is copied.
+ * @param   anotherDeque    Deque to be swapped with
+ */
+template<class T>
+void Deque<T>::Swap(Deque<T>& anotherDeque)
+{
+    std::swap(chunkMap,         anotherDeque.chunkMap);
+    std::swap(mapCapacity,      anotherDeque.mapCapacity);
+    std::swap(firstChunk,       anotherDeque.firstChunk);
+    std::swap(chunkCount,       anotherDeque.chunkCount);
+    std::swap(firstOffset,      anotherDeque.firstOffset);
+    std::swap(numberOfElements, anotherDeque.numberOfElements);
+    std::swap(spareChunk,       anotherDeque.spareChunk);
+}
+
+/**
+ * @brief   Prints all elements, separated by spaces.
+ * @param   stream  Output stream
+ */
+template<class T>
+void Deque<T>::PrintAll(std::ostream& stream) const
+{
+    for(size_t index = 0; index < numberOfElements; index++)
+        stream << At(index) << " ";
+}
+
+/**
+ * @brief   Stream insertion operator
+ * @param   stream  Output stream
+ * @param   deque   Deque to be printed
+ * @return  lValue reference to the stream to support cascaded streams
+ */
+template<class T>
+std::ostream& operator<<(std::ostream& stream, const Deque<T>& deque)
+{
+    if(deque.isEmpty() == true)
+        stream << "-- empty deque --";
+    else
+        deque.PrintAll(stream);
+
+    return stream; // Support cascaded streams
+}
+
+/**
+ * @brief   Iterator to the first element.
+ * @return  Iterator equal to end() if the deque is empty.
+ */
+template<class T>
+typename Deque<T>::iterator Deque<T>::begin()
+{
+    if(isEmpty() == true)
+        return iterator();
+
+    return iterator(chunkMap + firstChunk, chunkMap + firstChunk + chunkCount - 1, firstOffset);
+}
+
+/**
+ * @brief   Iterator past the last element.
+ * @return  Iterator equal to begin() if the deque is empty.
+ * @note    If the last chunk is full, it points to the end of that chunk.
+ */
+template<class T>
+typename Deque<T>::iterator Deque<T>::end()
+{
+    if(isEmpty() == true)
+        return iterator();
+
+    Array<T>** const lastChunk = chunkMap + firstChunk + chunkCount - 1;
+    const size_t offset = firstOffset + numberOfElements - (chunkCount - 1) * chunkCapacity;
+
+    return iterator(lastChunk, lastChunk, offset);
+}
+
+/**
+ * @brief   Reaches an element without checking the index.
+ * @param   index   Position of the element, counted from the first one
+ * @return  lValue reference to the element
+ */
+template<class T>
+T& Deque<T>::At(const size_t index) const
+{
+    const size_t position = firstOffset + index;
+    return chunkMap[firstChunk + position / chunkCapacity]->begin()[position & chunkMask];
+}
+
+/**
+ * @brief   Throws an exception with the related information messages.
+ * @param   index   Index of the failed access
+ * @throws  std::range_error Always
+ */
+template<class T>
+void Deque<T>::ThrowOutOfRange(const size_t index) const
+{
+    std::string errorMessage = "Out-of-Range Exception Occured ";
+                errorMessage += "(Size = "  + std::to_string(numberOfElements)  + ") ";
+                errorMessage += "(Index = " + std::to_string(index)             + ") ";
+    throw std::range_error(errorMessage);
+}
+
+/**
+ * @brief   Releases the resources held by a removed element, e.g. the buffer of a string.
+ * @param   slot    Slot of the removed element
+ * @note    Trivially destructible elements hold no resources and are left as they are.
+ */
+template<class T>
+void Deque<T>::ResetSlot(T& slot)
+{
+    if constexpr(std::is_trivially_destructible<T>::value == false)
+        slot = T();
+}
+
+/**
+ * @brief   Provides a chunk for a new element.
+ * @return  Spare chunk if there is one, a new chunk otherwise.
+ */
+template<class T>
+Array<T>* Deque<T>::AcquireChunk()
+{
+    Array<T>* chunk = spareChunk;
+
+    if(chunk == nullptr)
+        chunk = new Array<T>(chunkCapacity);
+    else
+        spareChunk = nullptr;
+
+    return chunk;
+}
+
+/**
+ * @brief   Takes back a chunk without elements.
+ * @param   chunk   Chunk to be released
+ * @note    Keeping a single spare chunk stops a queue oscillating around a chunk boundary from allocating.
+ */
+template<class T>
+void Deque<T>::ReleaseChunk(Array<T>* chunk)
+{
+    if(spareChunk == nullptr)
+        spareChunk = chunk;
+    else
+        delete chunk;
+}
+
+/**
+ * @brief   Makes sure the map entry before the first chunk exists.
+ * @note    An empty deque places its first chunk into the middle of the map.
+ */
+template<class T>
+void Deque<T>::ReserveChunkAtFront()
+{
+    if(chunkCount == 0)
+    {
+        if(mapCapacity == 0)
+            RebuildMap(true);
+
+        firstChunk = mapCapacity / 2 + 1;   // Decremented by the caller
+    }
+    else if(firstChunk == 0)
+        RebuildMap(true);
+    else;
+}
+
+/**
+ * @brief   Makes sure the map entry after the last chunk exists.
+ * @note    An empty deque places its first chunk into the middle of the map.
+ */
+template<class T>
+void Deque<T>::ReserveChunkAtBack()
+{
+    if(chunkCount == 0)
+    {
+        if(mapCapacity == 0)
+            RebuildMap(false);
+
+        firstChunk = mapCapacity / 2;
+    }
+    else if(firstChunk + chunkCount == mapCapacity)
+        RebuildMap(false);
+    else;
+}
+
+/**
+ * @brief   Centers the chunks in the map, which is doubled if the chunks fill half of it.
+ * @param   roomAtFront     The free entry is needed before the first chunk, otherwise after the last one.
+ * @note    Only the chunk pointers move, the elements stay where they are.
+ */
+template<class T>
+void Deque<T>::RebuildMap(const bool roomAtFront)
+{
+    const size_t neededChunks = chunkCount + 1;
+
+    // Centering in place is enough while the chunks fill at most half of the map, queues drifting to one side stay in the same map
+    const bool grow = (neededChunks * 2 > mapCapacity);
+    const size_t newCapacity = grow ? ((mapCapacity < 4) ? 8 : mapCapacity * 2) : mapCapacity;
+    const size_t newFirst = (newCapacity - neededChunks) / 2 + (roomAtFront ? 1 : 0);
+
+    Array<T>** newMap = grow ? new Array<T>*[newCapacity]() : chunkMap;
+
+    if(grow == true)
+    {
+        for(size_t index = 0; index < chunkCount; index++)
+            newMap[newFirst + index] = chunkMap[firstChunk + index];
+
+        delete [] chunkMap;
+    }
+    else if(newFirst < firstChunk)      // Moving towards the front, copy forwards
+    {
+        for(size_t index = 0; index < chunkCount; index++)
+            newMap[newFirst + index] = chunkMap[firstChunk + index];
+
+        for(size_t index = newFirst + chunkCount; index < firstChunk + chunkCount; index++)
+            newMap[index] = nullptr;
+    }
+    else if(newFirst > firstChunk)      // Moving towards the back, copy backwards
+    {
+        for(size_t index = chunkCount; index > 0; index--)
+            newMap[newFirst + index - 1] = chunkMap[firstChunk + index - 1];
+
+        for(size_t index = firstChunk; index < newFirst; index++)
+            newMap[index] = nullptr;
+    }
+    else;
+
+    chunkMap    = newMap;
+    mapCapacity = newCapacity;
+    firstChunk  = newFirst;
+}
+
+/**
+ * @brief   Frees the chunks and the map, used by the destructor.
+ */
+template<class T>
+void Deque<T>::ReleaseAll()
+{
+    EraseAll();
+
+    delete [] chunkMap;
+    chunkMap    = nullptr;
+    mapCapacity = 0;
+    firstChunk  = 0;
+}
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,347 @@
+/** @file       FastOstreamIterator.h
+ *  @details    Buffered replacement for std::ostream_iterator.
+ *              Values are formatted with std::to_chars into an internal buffer and the
+ *              delimiter is copied next to them, so no formatted stream call is made per element.
+ *              The buffer is flushed in large blocks to an ostream or to a file descriptor.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Requires C++17 for std::to_chars and std::string_view.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef FAST_OSTREAM_ITERATOR_H
+#define FAST_OSTREAM_ITERATOR_H
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <iterator>
+#include <type_traits>
+#include <system_error>
+
+#include <cerrno>
+#include <unistd.h>
+
+/**
+ * @brief   Block buffer that collects formatted text and writes it to an ostream or a file descriptor.
+ */
+class OutputBuffer{
+public:
+    static constexpr size_t defaultCapacity = 64 * 1024;
+
+    OutputBuffer(std::ostream& stream, const size_t capacity = defaultCapacity);    // Flush to an output stream
+    OutputBuffer(const int fileDescriptor, const size_t capacity = defaultCapacity); // Flush to a file descriptor
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    ~OutputBuffer();    // Flushes the remaining content
+
+    void Append(const char* data, const size_t length);     // Copies raw characters
+    void Append(std::string_view text)  { Append(text.data(), text.size()); }
+
+    template<class T>
+    void AppendValue(const T& value);                       // Formats a value into the buffer
+
+    void Flush();                                           // Writes the buffered content out
+
+    size_t GetCapacity() const  { return capacity;  }
+    size_t GetUsed() const      { return used;      }
+
+    /*** Direct Access ***/
+    // Reserves at least the given amount of space and returns the write position
+    char* Reserve(const size_t length);
+    // Commits the characters written to the reserved space
+    void Commit(const size_t length)    { used += length; }
+
+private:
+    void WriteOut(const char* data, const size_t length);  // Sends data to the sink
+
+    std::ostream* stream    = nullptr;  // Sink stream, nullptr if a file descriptor is used
+    int fileDescriptor      = -1;       // Sink descriptor, -1 if a stream is used
+    size_t capacity         = 0;        // Buffer capacity in bytes
+    size_t used             = 0;        // Number of buffered bytes
+    std::unique_ptr<char[]> buffer;     // Internal buffer
+};
+
+namespace FastFormat {
+
+/**
+ * @brief   Upper bound of the characters needed to format an arithmetic value.
+ * @note    Covers the longest double representation produced by std::to_chars.
+ */
+constexpr size_t maxArithmeticLength = 64;
+
+// Character types are written as characters, just like the stream insertion does
+template<class T>
+using IsCharacter = std::integral_constant<bool,    std::is_same<T, char>::value ||
+                                                    std::is_same<T, signed char>::value ||
+                                                    std::is_same<T, unsigned char>::value>;
+
+template<class T>
+using IsFormattableNumber = std::integral_constant<bool,    std::is_arithmetic<T>::value &&
+                                                            !std::is_same<T, bool>::value &&
+                                                            !IsCharacter<T>::value>;
+
+template<class T>
+using IsStringLike = std::is_convertible<const T&, std::string_view>;
+
+/**
+ * @brief   Formats a value into a caller provided character array.
+ * @param   destination Destination array.
+ * @param   capacity    Size of the destination array.
+ * @param   value       Value to be formatted.
+ * @return  Number of characters written.
+ * @note    Output is truncated if it doesn't fit. Numbers are never truncated
+ *          as long as the capacity is at least maxArithmeticLength.
+ */
+template<class T>
+size_t FormatTo(char* destination, const size_t capacity, const T& value)
+{
+    std::string_view text;
+    std::string formatted;  // Only used by the slow path
+
+    if constexpr(IsFormattableNumber<T>::value)
+    {
+        const std::to_chars_result result = std::to_chars(destination, destination + capacity, value);
+        return (result.ec == std::errc()) ? static_cast<size_t>(result.ptr - destination) : 0;
+    }
+    else if constexpr(IsCharacter<T>::value)
+        text = std::string_view(reinterpret_cast<const char*>(&value), 1);
+    else if constexpr(std::is_same<T, bool>::value)
+        text = value ? "1" : "0";
+    else if constexpr(IsStringLike<T>::value)
+        text = std::string_view(value);
+    else
+    {
+        std::ostringstream formatter;   // Slow path for user defined types
+        formatter << value;
+        formatted   = formatter.str();
+        text        = formatted;
+    }
+
+    const size_t length = (text.size() < capacity) ? text.size() : capacity;
+    std::memcpy(destination, text.data(), length);
+
+    return length;
+}
+
+} // namespace FastFormat
+
+/**
+ * @brief   Constructs a buffer flushing to an output stream.
+ * @param   stream      Destination stream.
+ * @param   capacity    Buffer size in bytes.
+ * @throws  std::logic_error When the capacity is smaller than a formatted number
+ */
+inline OutputBuffer::OutputBuffer(std::ostream& stream, const size_t capacity)
+: stream(&stream), fileDescriptor(-1), capacity(capacity), used(0), buffer(nullptr)
+{
+    if(capacity < FastFormat::maxArithmeticLength)
+        throw std::logic_error("Output buffer is too small!");
+
+    buffer.reset(new char[capacity]);
+}
+
+/**
+ * @brief   Constructs a buffer flushing to a file descriptor.
+ * @param   fileDescriptor  Destination descriptor, it is not closed by the buffer.
+ * @param   capacity        Buffer size in bytes.
+ * @throws  std::logic_error When the capacity is smaller than a formatted number
+ * @throws  std::logic_error When the file descriptor is invalid
+ */
+inline OutputBuffer::OutputBuffer(const int fileDescriptor, const size_t capacity)
+: stream(nullptr), fileDescriptor(fileDescriptor), capacity(capacity), used(0), buffer(nullptr)
+{
+    if(capacity < FastFormat::maxArithmeticLength)
+        throw std::logic_error("Output buffer is too small!");
+    else if(fileDescriptor < 0)
+        throw std::logic_error("Invalid file descriptor!");
+    else;
+
+    buffer.reset(new char[capacity]);
+}
+
+/**
+ * @brief   Destructor, flushes the remaining content.
+ * @note    Errors cannot be reported from a destructor, call Flush() to observe them.
+ */
+inline OutputBuffer::~OutputBuffer()
+{
+    try         { Flush(); }
+    catch(...)  { /* Nothing to do */ }
+}
+
+/**
+ * @brief   Copies the given characters into the buffer.
+ * @param   data    Source characters.
+ * @param   length  Number of characters.
+ * @note    Blocks larger than the buffer are written out directly.
+ */
+inline void OutputBuffer::Append(const char* data, const size_t length)
+{
+    if(used + length <= capacity)   // Most common path, fits into the buffer
+    {
+        std::memcpy(buffer.get() + used, data, length);
+        used += length;
+        return;
+    }
+
+    Flush();
+
+    if(length >= capacity)  // Copying would only split the block, write it directly
+        WriteOut(data, length);
+    else
+    {
+        std::memcpy(buffer.get(), data, length);
+        used = length;
+    }
+}
+
+/**
+ * @brief   Reserves space at the end of the buffer.
+ * @param   length  Required space, must not exceed the capacity.
+ * @return  Write position, Commit() must be called with the written amount.
+ * @throws  std::logic_error When the requested space exceeds the capacity.
+ */
+inline char* OutputBuffer::Reserve(const size_t length)
+{
+    if(length > capacity)
+        throw std::logic_error("Reservation exceeds the buffer capacity!");
+
+    if(used + length > capacity)
+        Flush();
+
+    return buffer.get() + used;
+}
+
+/**
+ * @brief   Formats a value and appends it to the buffer.
+ * @param   value   Value to be formatted.
+ * @note    Numbers are formatted by FastFormat::FormatTo, string-like values are copied.
+ *          Other types fall back to their stream insertion operator.
+ * @note    Floating point values are written in their shortest round-trip form,
+ *          which differs from the 6-digit default of the streams.
+ */
+template<class T>
+void OutputBuffer::AppendValue(const T& value)
+{
+    if constexpr(FastFormat::IsFormattableNumber<T>::value)
+    {
+        char* position = Reserve(FastFormat::maxArithmeticLength);
+        Commit(FastFormat::FormatTo(position, FastFormat::maxArithmeticLength, value));
+    }
+    else if constexpr(FastFormat::IsCharacter<T>::value)
+        Append(reinterpret_cast<const char*>(&value), 1);
+    else if constexpr(std::is_same<T, bool>::value)
+        Append(value ? "1" : "0", 1);   // Same as the default stream formatting
+    else if constexpr(FastFormat::IsStringLike<T>::value)
+        Append(std::string_view(value));
+    else
+    {
+        std::ostringstream formatter;   // Slow path for user defined types
+        formatter << value;
+        Append(formatter.str());
+    }
+}
+
+/**
+ * @brief   Writes the buffered content to the sink.
+ * @throws  std::system_error When the write fails.
+ */
+inline void OutputBuffer::Flush()
+{
+    if(used == 0)
+        return;
+
+    const size_t length = used;
+    used = 0;   // Buffer is considered empty even if the write fails
+
+    WriteOut(buffer.get(), length);
+}
+
+/**
+ * @brief   Sends the data to the sink as a single block.
+ * @param   data    Source characters.
+ * @param   length  Number of characters.
+ * @throws  std::system_error When the write fails.
+ */
+inline void OutputBuffer::WriteOut(const char* data, const size_t length)
+{
+    if(stream != nullptr)
+    {
+        stream->write(data, static_cast<std::streamsize>(length));
+
+        if(stream->fail() == true)
+            throw std::system_error(std::make_error_code(std::errc::io_error), "Stream write failed!");
+
+        return;
+    }
+
+    size_t written = 0;
+    while(written < length) // Write may be partial
+    {
+        const ssize_t result = ::write(fileDescriptor, data + written, length - written);
+
+        if(result < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            throw std::system_error(errno, std::generic_category(), "Write failed!");
+        }
+
+        written += static_cast<size_t>(result);
+    }
+}
+
+/**
+ * @brief   Output iterator formatting the assigned values into a shared OutputBuffer.
+ * @note    Copies of an iterator share the same buffer, so the iterator can be passed
+ *          to std::copy by value. The buffer is flushed when the last copy is destroyed
+ *          or when Flush() is called.
+ */
+template<class T>
+class FastOstreamIterator{
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+
+    FastOstreamIterator(std::ostream& stream, const char* delimiter = nullptr,
+                        const size_t bufferSize = OutputBuffer::defaultCapacity)
+    : buffer(std::make_shared<OutputBuffer>(stream, bufferSize)), delimiter(delimiter != nullptr ? delimiter : "")
+    { /* Empty constructor */ }
+
+    FastOstreamIterator(const int fileDescriptor, const char* delimiter = nullptr,
+                        const size_t bufferSize = OutputBuffer::defaultCapacity)
+    : buffer(std::make_shared<OutputBuffer>(fileDescriptor, bufferSize)), delimiter(delimiter != nullptr ? delimiter : "")
+    { /* Empty constructor */ }
+
+    FastOstreamIterator& operator=(const T& value)  // Formats the value followed by the delimiter
+    {
+        buffer->AppendValue(value);
+        buffer->Append(delimiter);
+        return *this;
+    }
+
+    FastOstreamIterator& operator*()        { return *this; }   // No-op, as in std::ostream_iterator
+    FastOstreamIterator& operator++()       { return *this; }   // No-op, as in std::ostream_iterator
+    FastOstreamIterator& operator++(int)    { return *this; }   // No-op, as in std::ostream_iterator
+
+    void Flush() { buffer->Flush(); }   // Writes the buffered content out
+
+private:
+    std::shared_ptr<OutputBuffer> buffer;   // Shared between the copies of the iterator
+    std::string_view delimiter;             // Must outlive the iterator, like std::ostream_iterator
+};
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,96 @@
+// Description: Benchmark of FastOstreamIterator against std::ostream_iterator
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 FastOstreamIteratorBenchmark.cpp -o FastOstreamIteratorBenchmark
+// Usage:       ./FastOstreamIteratorBenchmark [elementCount] [outputPath]
+//              (defaults: 10000000 and /dev/null)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Benchmark.h"
+#include "FastOstreamIterator.h"
+
+using namespace std;
+
+// Prints a result row with the throughput in MB/s
+static void Report(const string& name, const double seconds, const size_t bytes)
+{
+    cout << setw(40) << left << name << right
+         << setw(10) << fixed << setprecision(4) << seconds << " s"
+         << setw(10) << setprecision(1) << (bytes / seconds) / 1e6 << " MB/s" << endl;
+}
+
+// Runs all writers for the given input
+template<class T>
+static void RunSuite(const string& title, const vector<T>& input, const char* path, const char* delimiter)
+{
+    const size_t repetitions = 3;
+
+    cout << title << endl;
+
+    // Output size is measured once, character devices do not report stream positions
+    ostringstream counter;
+    copy(input.begin(), input.end(), ostream_iterator<T>(counter, delimiter));
+    const size_t bytes = counter.str().size();
+
+    const double standard = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        copy(input.begin(), input.end(), ostream_iterator<T>(file, delimiter));
+    });
+    Report("std::ostream_iterator -> ofstream", standard, bytes);
+
+    for(const size_t bufferSize : {4096ul, 65536ul, 1048576ul})
+    {
+        const double fastStream = Benchmark::MeasureBest(repetitions, [&]()
+        {
+            ofstream file(path);
+            copy(input.begin(), input.end(), FastOstreamIterator<T>(file, delimiter, bufferSize));
+        });
+        Report("FastOstreamIterator -> ofstream (" + to_string(bufferSize / 1024) + "K)", fastStream, bytes);
+
+        const double fastDescriptor = Benchmark::MeasureBest(repetitions, [&]()
+        {
+            const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            copy(input.begin(), input.end(), FastOstreamIterator<T>(fd, delimiter, bufferSize));
+            close(fd);
+        });
+        Report("FastOstreamIterator -> fd (" + to_string(bufferSize / 1024) + "K)", fastDescriptor, bytes);
+    }
+
+    cout << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t elementCount = (argc > 1) ? stoull(argv[1]) : 10000000;
+    const char* path          = (argc > 2) ? argv[2] : "/dev/null";
+
+    vector<int> integers(elementCount);
+    iota(integers.begin(), integers.end(), -static_cast<int>(elementCount / 2));
+    RunSuite("Integers (" + to_string(elementCount) + ")", integers, path, " ");
+
+    vector<double> doubles(elementCount);
+    for(size_t index = 0; index < elementCount; index++)
+        doubles[index] = index * 0.37;
+    RunSuite("Doubles (" + to_string(elementCount) + ")", doubles, path, " ");
+
+    vector<string> errors(elementCount / 4);
+    for(size_t index = 0; index < errors.size(); index++)
+        errors[index] = "Error " + to_string(index);
+    RunSuite("Strings (" + to_string(errors.size()) + ")", errors, path, "\r\n");
+
+    return 0;
+}
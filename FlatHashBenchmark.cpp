@@ -0,0 +1,117 @@
+// Description: Insert and lookup cost of FlatHashSet across load factors, against std::unordered_set
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 FlatHashBenchmark.cpp -o FlatHashBenchmark
+// Usage:       ./FlatHashBenchmark [log2 buckets] [lookups]
+//              (defaults: 20 and 1000000)
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "FlatHashContainer.h"
+
+using namespace std;
+
+static const size_t repetitions = 3;
+
+struct Measurement{
+    double insertNs = 0;    // Per inserted key
+    double hitNs    = 0;    // Per successful lookup
+    double missNs   = 0;    // Per failed lookup
+};
+
+// Times the insertions and the lookups of a set exposing Insert and Contains like calls
+template<class InsertType, class ContainsType>
+static Measurement Measure(const vector<uint64_t>& keys, const vector<uint64_t>& hits, const vector<uint64_t>& misses,
+                           InsertType insert, ContainsType contains)
+{
+    Measurement measurement;
+
+    Benchmark::Stopwatch watch;
+    for(const uint64_t key : keys)
+        insert(key);
+    measurement.insertNs = watch.ElapsedSeconds() * 1e9 / keys.size();
+
+    auto lookup = [&](const vector<uint64_t>& probes)
+    {
+        return Benchmark::MeasureBest(repetitions, [&]()
+        {
+            size_t found = 0;
+            for(const uint64_t key : probes)
+                found += contains(key) ? 1 : 0;
+
+            Benchmark::DoNotOptimize(found);
+        }) * 1e9 / probes.size();
+    };
+
+    measurement.hitNs   = lookup(hits);
+    measurement.missNs  = lookup(misses);
+
+    return measurement;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t buckets = size_t(1) << ((argc > 1) ? strtoul(argv[1], nullptr, 10) : 20);
+    const size_t lookups = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 1000000;
+
+    mt19937_64 generator(7);
+
+    cout << setw(16) << left << "container" << right << setw(8) << "load" << setw(12) << "insert ns"
+         << setw(10) << "hit ns" << setw(10) << "miss ns" << setw(10) << "probes" << setw(12) << "bytes/key" << endl;
+
+    for(const double loadFactor : {0.5, 0.7, 0.8, 0.875, 0.95})
+    {
+        // Even keys are stored, odd probes miss
+        vector<uint64_t> keys(static_cast<size_t>(buckets * loadFactor));
+        for(uint64_t& key : keys)
+            key = generator() & ~1ull;
+
+        vector<uint64_t> hits(lookups), misses(lookups);
+        for(size_t index = 0; index < lookups; index++)
+        {
+            hits[index]     = keys[generator() % keys.size()];
+            misses[index]   = generator() | 1;
+        }
+
+        // Fixed bucket counts, so both containers run at the given load factor
+        FlatHashSet<uint64_t> flat;
+        flat.SetMaxLoadFactor(0.99);
+        flat.Rehash(buckets);
+
+        const Measurement flatResult = Measure(keys, hits, misses,
+            [&](const uint64_t key) { flat.Insert(key); },
+            [&](const uint64_t key) { return flat.Contains(key); });
+
+        unordered_set<uint64_t> standard;
+        standard.max_load_factor(1);
+        standard.reserve(buckets);
+
+        const Measurement standardResult = Measure(keys, hits, misses,
+            [&](const uint64_t key) { standard.insert(key); },
+            [&](const uint64_t key) { return standard.count(key) != 0; });
+
+        // Nodes of the standard set: the key, the next pointer and the cached hash, plus one bucket pointer per bucket
+        const double standardBytes = static_cast<double>(standard.size() * (sizeof(uint64_t) + 2 * sizeof(void*)) +
+                                                         standard.bucket_count() * sizeof(void*)) / standard.size();
+
+        cout << fixed << setprecision(2)
+             << setw(16) << left << "FlatHashSet" << right << setw(8) << flat.GetLoadFactor()
+             << setw(12) << flatResult.insertNs << setw(10) << flatResult.hitNs << setw(10) << flatResult.missNs
+             << setw(10) << flat.GetAverageProbeLength()
+             << setw(12) << static_cast<double>(flat.GetMemoryBytes()) / flat.getSize() << endl
+             << setw(16) << left << "unordered_set" << right << setw(8) << standard.load_factor()
+             << setw(12) << standardResult.insertNs << setw(10) << standardResult.hitNs << setw(10) << standardResult.missNs
+             << setw(10) << "-" << setw(12) << standardBytes << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,821 @@
+/** @file       FlatHashContainer.h
+ *  @details    Open addressing hash containers over Array buffers.
+ *              FlatHashSet and FlatHashMap keep their elements in a single Array, a parallel Array of
+ *              16 bit counters holds the probe distance of each bucket. Collisions are resolved by Robin Hood
+ *              probing: an element with a longer probe distance takes over the bucket of a closer one,
+ *              so the probe lengths stay short and even, and a lookup stops as soon as it meets an element
+ *              closer to its home than the searched one. Removals shift the following elements back,
+ *              no tombstone is left behind.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       The buffers are Array instances, so the element types must be default constructible and assignable.
+ *  @note       Heterogeneous lookups are enabled when both the hash and the equality define is_transparent,
+ *              e.g. FlatHashSet<std::string, TransparentStringHash, std::equal_to<>> can be searched by a string_view.
+ *  @note       Insertions and removals invalidate the pointers returned by Find.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef FLAT_HASH_CONTAINER_H
+#define FLAT_HASH_CONTAINER_H
+
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+
+/**
+ * @brief   String hash accepting std::string, std::string_view and C strings alike.
+ */
+struct TransparentStringHash{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view text) const { return std::hash<std::string_view>()(text); }
+};
+
+/**
+ * @brief   Tells whether a lookup by the query type can skip the conversion to the key type.
+ * @note    True when both the hash and the equality declare is_transparent.
+ */
+template<class Query, class Hash, class Equal, class = void>
+struct FlatHashHeterogeneous : std::false_type {};
+
+template<class Query, class Hash, class Equal>
+struct FlatHashHeterogeneous<Query, Hash, Equal, std::void_t<typename Hash::is_transparent, typename Equal::is_transparent>> : std::true_type {};
+
+/**
+ * @brief   Robin Hood table shared by FlatHashSet and FlatHashMap.
+ * @note    KeyOf reaches the key of an entry, the entry is the key itself for the set and a pair for the map.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+class RobinHoodTable{
+public:
+    template<class Query>
+    using EnableHeterogeneous = typename std::enable_if<FlatHashHeterogeneous<Query, Hash, Equal>::value>::type;
+
+    RobinHoodTable() = default;
+    RobinHoodTable(const RobinHoodTable& anotherTable);
+    RobinHoodTable(RobinHoodTable&& anotherTable);
+    ~RobinHoodTable();
+
+    RobinHoodTable& operator=(RobinHoodTable anotherTable)     // Copy and move assignment, by copy and swap
+    { Swap(anotherTable); return *this; }
+
+    template<class Query>
+    Entry* Find(const Query& query) const;          // Entry of the key, nullptr if absent
+    std::pair<Entry*, bool> Insert(Entry&& entry);  // Entry of the key and whether it was inserted
+
+    template<class Query>
+    bool Erase(const Query& query);                 // Removes the entry of the key
+
+    void Reserve(const size_t elements);            // Sizes the buckets for the given elements under the load factor
+    void Rehash(const size_t buckets);              // Rebuilds with at least the given number of buckets
+    void EraseAll();                                // Removes all entries and frees the buffers
+    void Swap(RobinHoodTable& anotherTable);
+
+    void SetMaxLoadFactor(const double loadFactor);
+    double GetMaxLoadFactor() const     { return maxLoadFactor; }
+    double GetLoadFactor() const        { return (bucketCount == 0) ? 0 : static_cast<double>(count) / bucketCount; }
+    double GetAverageProbeLength() const;           // Mean number of buckets visited to find a stored key
+
+    size_t getSize() const              { return count; }
+    size_t GetBucketCount() const       { return bucketCount; }
+    size_t GetMemoryBytes() const       { return bucketCount * (sizeof(Entry) + sizeof(uint16_t)); }
+
+    template<class CallableType>
+    void ForEach(CallableType callable) const;      // Calls callable(entry) for each entry, in bucket order
+
+private:
+    static constexpr uint16_t maxDistance = 65535;  // Distances are stored plus one, zero marks an empty bucket
+
+    template<class Query>
+    size_t Home(const Query& query) const;          // Bucket where the probe of the key starts
+    void Allocate(const size_t buckets);            // Replaces the buffers by empty ones
+    Entry* Place(Entry&& entry);                    // Inserts an entry known to be absent, returns where it landed
+
+    Array<Entry>* entries       = nullptr;  // Buckets, nullptr until the first insertion
+    Array<uint16_t>* distances  = nullptr;  // Probe distance plus one of each bucket, zero if empty
+    size_t bucketCount          = 0;        // Power of two
+    unsigned shift              = 64;       // 64 - log2(bucketCount), selects the top bits of the mixed hash
+    size_t count                = 0;        // Number of entries
+    double maxLoadFactor        = 0.875;    // Grows beyond this share of used buckets
+    Hash hash;
+    Equal equal;
+};
+
+
+/**
+ * @brief   Copy constructor
+ * @param   anotherTable    Source table, its bucket layout is copied as is
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::RobinHoodTable(const RobinHoodTable& anotherTable)
+: shift(anotherTable.shift), maxLoadFactor(anotherTable.maxLoadFactor), hash(anotherTable.hash), equal(anotherTable.equal)
+{
+    if(anotherTable.bucketCount == 0)
+        return;
+
+    entries     = new Array<Entry>(*anotherTable.entries);
+
+    try
+    {
+        distances = new Array<uint16_t>(*anotherTable.distances);
+    }
+    catch(...)
+    {
+        delete entries;
+        throw;
+    }
+
+    bucketCount = anotherTable.bucketCount;
+    count       = anotherTable.count;
+}
+
+/**
+ * @brief   Move constructor, takes over the buffers of the source table.
+ * @param   anotherTable    Source table, left empty
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::RobinHoodTable(RobinHoodTable&& anotherTable)
+{
+    Swap(anotherTable);
+}
+
+/**
+ * @brief   Destructor
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::~RobinHoodTable()
+{
+    delete entries;
+    delete distances;
+}
+
+/**
+ * @brief   Searches the entry of a key.
+ * @param   query   Key, or a value comparable to the keys if the lookup is heterogeneous
+ * @return  Address of the entry, nullptr if the key is absent.
+ * @note    Stops at the first bucket whose entry is closer to its home than the probe is to the query's home,
+ *          the key would have displaced that entry if it were in the table.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+template<class Query>
+Entry* RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Find(const Query& query) const
+{
+    if(count == 0)
+        return nullptr;
+
+    const uint16_t* const distanceBuffer = distances->begin();
+    Entry* const entryBuffer            = entries->begin();
+    const size_t mask                   = bucketCount - 1;
+
+    size_t bucket       = Home(query);
+    unsigned distance   = 1;
+
+    while(distanceBuffer[bucket] >= distance)
+    {
+        if((distanceBuffer[bucket] == distance) && equal(KeyOf()(entryBuffer[bucket]), query))
+            return entryBuffer + bucket;
+
+        bucket = (bucket + 1) & mask;
+        distance++;
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief   Inserts an entry unless its key is already in the table.
+ * @param   entry   Entry to be inserted, left untouched if its key exists
+ * @return  Address of the entry of the key, true if it was inserted.
+ * @note    The probe displaces the entries closer to their home than the carried one and carries them on.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+std::pair<Entry*, bool> RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Insert(Entry&& entry)
+{
+    Entry* existing = Find(KeyOf()(entry));
+    if(existing != nullptr)
+        return std::make_pair(existing, false);
+
+    if(static_cast<double>(count + 1) > bucketCount * maxLoadFactor)
+        Rehash((bucketCount == 0) ? 16 : bucketCount * 2);
+
+    return std::make_pair(Place(std::move(entry)), true);
+}
+
+/**
+ * @brief   Removes the entry of a key, the following entries of the cluster shift back by one bucket.
+ * @param   query   Key, or a value comparable to the keys if the lookup is heterogeneous
+ * @return  true If the key was found and removed.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+template<class Query>
+bool RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Erase(const Query& query)
+{
+    Entry* const found = Find(query);
+    if(found == nullptr)
+        return false;
+
+    uint16_t* const distanceBuffer  = distances->begin();
+    Entry* const entryBuffer        = entries->begin();
+    const size_t mask               = bucketCount - 1;
+
+    size_t bucket   = found - entryBuffer;
+    size_t next     = (bucket + 1) & mask;
+
+    while(distanceBuffer[next] > 1)     // The next entry is away from its home, it moves one bucket closer
+    {
+        entryBuffer[bucket]     = std::move(entryBuffer[next]);
+        distanceBuffer[bucket]  = distanceBuffer[next] - 1;
+
+        bucket  = next;
+        next    = (next + 1) & mask;
+    }
+
+    entryBuffer[bucket]     = Entry();  // Releases the resources of the vacated bucket
+    distanceBuffer[bucket]  = 0;
+    count--;
+
+    return true;
+}
+
+/**
+ * @brief   Sizes the table so that the given number of elements fits without growing.
+ * @param   elements    Expected number of elements
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+void RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Reserve(const size_t elements)
+{
+    const size_t needed = static_cast<size_t>(elements / maxLoadFactor) + 1;
+
+    if(needed > bucketCount)
+        Rehash(needed);
+}
+
+/**
+ * @brief   Rebuilds the table with a new number of buckets.
+ * @param   buckets Minimum number of buckets, rounded up to a power of two and to the load factor of the entries
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+void RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Rehash(const size_t buckets)
+{
+    size_t newCount = 16;
+    while((newCount < buckets) || (newCount * maxLoadFactor < count))
+        newCount *= 2;
+
+    Array<Entry>* const oldEntries      = entries;
+    Array<uint16_t>* const oldDistances = distances;
+    const size_t oldCount               = bucketCount;
+
+    Allocate(newCount);
+    count = 0;
+
+    for(size_t bucket = 0; bucket < oldCount; bucket++)
+    {
+        if(oldDistances->begin()[bucket] != 0)
+            Place(std::move(oldEntries->begin()[bucket]));
+    }
+
+    delete oldEntries;
+    delete oldDistances;
+}
+
+/**
+ * @brief   Removes all entries and frees the buffers.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+void RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::EraseAll()
+{
+    delete entries;
+    delete distances;
+
+    entries     = nullptr;
+    distances   = nullptr;
+    bucketCount = 0;
+    shift       = 64;
+    count       = 0;
+}
+
+/**
+ * @brief   Exchanges the content of two tables, no entry is copied.
+ * @param   anotherTable    Table to be swapped with
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+void RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Swap(RobinHoodTable& anotherTable)
+{
+    std::swap(entries,          anotherTable.entries);
+    std::swap(distances,        anotherTable.distances);
+    std::swap(bucketCount,      anotherTable.bucketCount);
+    std::swap(shift,            anotherTable.shift);
+    std::swap(count,            anotherTable.count);
+    std::swap(maxLoadFactor,    anotherTable.maxLoadFactor);
+    std::swap(hash,             anotherTable.hash);
+    std::swap(equal,            anotherTable.equal);
+}
+
+/**
+ * @brief   Changes the share of used buckets beyond which the table grows.
+ * @param   loadFactor  Value in (0, 1), higher values save memory for longer probes
+ * @throws  std::invalid_argument If the value is out of range
+ * @note    The table is rebuilt at once if it is above the new limit.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+void RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::SetMaxLoadFactor(const double loadFactor)
+{
+    if((loadFactor <= 0) || (loadFactor >= 1))
+        throw std::invalid_argument("Load factor must be between 0 and 1!");
+
+    maxLoadFactor = loadFactor;
+
+    if(count > bucketCount * maxLoadFactor)
+        Rehash(bucketCount);
+}
+
+/**
+ * @brief   Computes the mean probe length of the stored keys.
+ * @return  Average number of buckets visited by a successful lookup, zero for an empty table.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+double RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::GetAverageProbeLength() const
+{
+    if(count == 0)
+        return 0;
+
+    size_t total = 0;
+    for(size_t bucket = 0; bucket < bucketCount; bucket++)
+        total += distances->begin()[bucket];
+
+    return static_cast<double>(total) / count;
+}
+
+/**
+ * @brief   Visits the entries.
+ * @param   callable    Called with a reference to each entry
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+template<class CallableType>
+void RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::ForEach(CallableType callable) const
+{
+    for(size_t bucket = 0; bucket < bucketCount; bucket++)
+    {
+        if(distances->begin()[bucket] != 0)
+            callable(entries->begin()[bucket]);
+    }
+}
+
+/**
+ * @brief   Maps a key to its home bucket.
+ * @param   query   Key or a value comparable to the keys
+ * @return  Bucket index.
+ * @note    The hash is multiplied by the 64 bit golden ratio and its top bits are taken, so weak hashes,
+ *          e.g. the identity hash of the integers, still spread over the buckets.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+template<class Query>
+size_t RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Home(const Query& query) const
+{
+    return static_cast<size_t>((static_cast<uint64_t>(hash(query)) * 0x9E3779B97F4A7C15ull) >> shift);
+}
+
+/**
+ * @brief   Replaces the buffers by empty ones, the previous buffers are left to the caller.
+ * @param   buckets Number of buckets, a power of two
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+void RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Allocate(const size_t buckets)
+{
+    Array<Entry>* const newEntries = new Array<Entry>(buckets);
+    Array<uint16_t>* newDistances = nullptr;
+
+    try
+    {
+        newDistances = new Array<uint16_t>(buckets);
+    }
+    catch(...)
+    {
+        delete newEntries;
+        throw;
+    }
+
+    std::fill(newDistances->begin(), newDistances->end(), 0);
+
+    entries     = newEntries;
+    distances   = newDistances;
+    bucketCount = buckets;
+    shift       = 64;
+
+    for(size_t power = buckets; power > 1; power /= 2)
+        shift--;
+}
+
+/**
+ * @brief   Robin Hood insertion of an entry whose key is known to be absent.
+ * @param   entry   Entry to be inserted
+ * @return  Address of the inserted entry.
+ * @note    If a carried entry would exceed the largest storable distance, the table doubles and the
+ *          carried entry is placed into the new table. This only happens with a very poor hash.
+ */
+template<class Entry, class Key, class KeyOf, class Hash, class Equal>
+Entry* RobinHoodTable<Entry, Key, KeyOf, Hash, Equal>::Place(Entry&& entry)
+{
+    Entry carried(std::move(entry));
+    Entry* placed = nullptr;    // Bucket of the inserted entry, the displaced ones are carried on
+
+    while(true)
+    {
+        uint16_t* const distanceBuffer  = distances->begin();
+        Entry* const entryBuffer        = entries->begin();
+        const size_t mask               = bucketCount - 1;
+
+        size_t bucket       = Home(KeyOf()(carried));
+        uint16_t distance   = 1;
+
+        while(distance < maxDistance)
+        {
+            if(distanceBuffer[bucket] == 0)     // Empty bucket, the probe ends
+            {
+                entryBuffer[bucket]     = std::move(carried);
+                distanceBuffer[bucket]  = distance;
+                count++;
+                return (placed != nullptr) ? placed : (entryBuffer + bucket);
+            }
+
+            if(distanceBuffer[bucket] < distance)   // The resident is richer, it gives its bucket away
+            {
+                std::swap(carried, entryBuffer[bucket]);
+                std::swap(distance, distanceBuffer[bucket]);
+                placed = (placed != nullptr) ? placed : (entryBuffer + bucket);
+            }
+
+            bucket = (bucket + 1) & mask;
+            distance++;
+        }
+
+        // Everything but the carried entry is in the table, it is placed after the rebuild
+        if(placed != nullptr)
+        {
+            const Key placedKey = KeyOf()(*placed);
+            Rehash(bucketCount * 2);
+            Place(std::move(carried));
+            return Find(placedKey);
+        }
+
+        Rehash(bucketCount * 2);
+    }
+}
+
+
+/**
+ * @brief   Reaches the key of a set entry, which is the key itself.
+ */
+struct FlatHashIdentity{
+    template<class T>
+    const T& operator()(const T& entry) const { return entry; }
+};
+
+/**
+ * @brief   Reaches the key of a map entry.
+ */
+struct FlatHashFirst{
+    template<class PairType>
+    const typename PairType::first_type& operator()(const PairType& entry) const { return entry.first; }
+};
+
+template<class T, class Hash = std::hash<T>, class Equal = std::equal_to<T>>
+class FlatHashSet{
+    using Table = RobinHoodTable<T, T, FlatHashIdentity, Hash, Equal>;
+
+public:
+    /*** Constructors and Destructors ***/
+    FlatHashSet() = default;                                // Default constructor
+    explicit FlatHashSet(const size_t expectedSize)         // Reserves for the given number of elements
+    { table.Reserve(expectedSize); }
+
+    template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+    FlatHashSet(InputIterator begin, InputIterator end);    // Bulk construction from a range
+    explicit FlatHashSet(const Array<T>& array);            // Bulk construction from an array
+    explicit FlatHashSet(List<T>& list);                    // Bulk construction from a list
+    FlatHashSet(std::initializer_list<T> initializerList);
+
+    /*** Lookup ***/
+    bool Contains(const T& key) const               { return (table.Find(key) != nullptr); }
+    template<class Query, class = typename Table::template EnableHeterogeneous<Query>>
+    bool Contains(const Query& query) const         { return (table.Find(query) != nullptr); }
+
+    /*** Modifiers ***/
+    bool Insert(const T& key)                       { return table.Insert(T(key)).second; }
+    bool Erase(const T& key)                        { return table.Erase(key); }
+    template<class Query, class = typename Table::template EnableHeterogeneous<Query>>
+    bool Erase(const Query& query)                  { return table.Erase(query); }
+    void EraseAll()                                 { table.EraseAll(); }
+    void Swap(FlatHashSet& anotherSet)              { table.Swap(anotherSet.table); }
+
+    /*** Capacity ***/
+    void Reserve(const size_t elements)             { table.Reserve(elements); }
+    void Rehash(const size_t buckets)               { table.Rehash(buckets); }
+    void SetMaxLoadFactor(const double loadFactor)  { table.SetMaxLoadFactor(loadFactor); }
+    double GetMaxLoadFactor() const                 { return table.GetMaxLoadFactor(); }
+    double GetLoadFactor() const                    { return table.GetLoadFactor(); }
+    double GetAverageProbeLength() const            { return table.GetAverageProbeLength(); }
+
+    /*** Status Checkers ***/
+    bool isEmpty() const                            { return (table.getSize() == 0); }
+    size_t getSize() const                          { return table.getSize(); }
+    size_t GetBucketCount() const                   { return table.GetBucketCount(); }
+    size_t GetMemoryBytes() const                   { return sizeof(*this) + table.GetMemoryBytes(); }
+
+    template<class CallableType>
+    void ForEach(CallableType callable) const       { table.ForEach(callable); }   // Calls callable(key) in no particular order
+
+private:
+    Table table;
+};
+
+/**
+ * @brief   Bulk construction, the table is sized once for the whole range.
+ * @param   begin   First element of the range
+ * @param   end     End of the half-open range
+ */
+template<class T, class Hash, class Equal>
+template<class InputIterator, class>
+FlatHashSet<T, Hash, Equal>::FlatHashSet(InputIterator begin, InputIterator end)
+{
+    if constexpr(std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>::value)
+        table.Reserve(std::distance(begin, end));
+
+    for(; begin != end; ++begin)
+        Insert(*begin);
+}
+
+/**
+ * @brief   Bulk construction from the elements of an array.
+ * @param   array   Source array, duplicates are dropped
+ */
+template<class T, class Hash, class Equal>
+FlatHashSet<T, Hash, Equal>::FlatHashSet(const Array<T>& array)
+: FlatHashSet(array.begin(), array.end())
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Bulk construction from the elements of a list.
+ * @param   list    Source list, duplicates are dropped
+ * @note    Walked by its node count, as the end iterator of List points to the last element.
+ */
+template<class T, class Hash, class Equal>
+FlatHashSet<T, Hash, Equal>::FlatHashSet(List<T>& list)
+{
+    if(list.isEmpty() == true)
+        return;
+
+    table.Reserve(list.GetNodeCount());
+
+    auto it = list.begin();
+    for(size_t index = 0; index < list.GetNodeCount(); index++, it++)
+        Insert(*it);
+}
+
+/**
+ * @brief   Constructs from the elements of the initializer list.
+ * @param   initializerList Source elements, duplicates are dropped
+ */
+template<class T, class Hash, class Equal>
+FlatHashSet<T, Hash, Equal>::FlatHashSet(std::initializer_list<T> initializerList)
+: FlatHashSet(initializerList.begin(), initializerList.end())
+{ /* Empty constructor */ }
+
+
+template<class K, class V, class Hash = std::hash<K>, class Equal = std::equal_to<K>>
+class FlatHashMap{
+    using Entry = std::pair<K, V>;
+    using Table = RobinHoodTable<Entry, K, FlatHashFirst, Hash, Equal>;
+
+public:
+    /*** Constructors and Destructors ***/
+    FlatHashMap() = default;                                // Default constructor
+    explicit FlatHashMap(const size_t expectedSize)         // Reserves for the given number of pairs
+    { table.Reserve(expectedSize); }
+
+    template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+    FlatHashMap(InputIterator begin, InputIterator end);    // Bulk construction from a range of pairs
+    explicit FlatHashMap(const Array<Entry>& array);        // Bulk construction from an array of pairs
+    explicit FlatHashMap(List<Entry>& list);                // Bulk construction from a list of pairs
+    FlatHashMap(std::initializer_list<Entry> initializerList);
+
+    /*** Lookup ***/
+    const V* Find(const K& key) const;                      // Address of the value, nullptr if the key is absent
+    V* Find(const K& key);
+    template<class Query, class = typename Table::template EnableHeterogeneous<Query>>
+    const V* Find(const Query& query) const;
+
+    bool Contains(const K& key) const               { return (table.Find(key) != nullptr); }
+    template<class Query, class = typename Table::template EnableHeterogeneous<Query>>
+    bool Contains(const Query& query) const         { return (table.Find(query) != nullptr); }
+
+    const V& At(const K& key) const;                // Value of the key, throws if the key is absent
+    V& At(const K& key);
+    V& operator[](const K& key);                    // Value of the key, inserted as default constructed if absent
+
+    /*** Modifiers ***/
+    bool Insert(const K& key, const V& value)       // Adds the pair if the key is absent
+    { return table.Insert(Entry(key, value)).second; }
+    bool InsertOrAssign(const K& key, const V& value);      // Adds the pair or replaces the value of the key
+    bool Erase(const K& key)                        { return table.Erase(key); }
+    template<class Query, class = typename Table::template EnableHeterogeneous<Query>>
+    bool Erase(const Query& query)                  { return table.Erase(query); }
+    void EraseAll()                                 { table.EraseAll(); }
+    void Swap(FlatHashMap& anotherMap)              { table.Swap(anotherMap.table); }
+
+    /*** Capacity ***/
+    void Reserve(const size_t elements)             { table.Reserve(elements); }
+    void Rehash(const size_t buckets)               { table.Rehash(buckets); }
+    void SetMaxLoadFactor(const double loadFactor)  { table.SetMaxLoadFactor(loadFactor); }
+    double GetMaxLoadFactor() const                 { return table.GetMaxLoadFactor(); }
+    double GetLoadFactor() const                    { return table.GetLoadFactor(); }
+    double GetAverageProbeLength() const            { return table.GetAverageProbeLength(); }
+
+    /*** Status Checkers ***/
+    bool isEmpty() const                            { return (table.getSize() == 0); }
+    size_t getSize() const                          { return table.getSize(); }
+    size_t GetBucketCount() const                   { return table.GetBucketCount(); }
+    size_t GetMemoryBytes() const                   { return sizeof(*this) + table.GetMemoryBytes(); }
+
+    template<class CallableType>
+    void ForEach(CallableType callable) const;      // Calls callable(key, value) in no particular order
+
+private:
+    Table table;
+};
+
+/**
+ * @brief   Bulk construction, the table is sized once for the whole range.
+ * @param   begin   First pair of the range
+ * @param   end     End of the half-open range
+ * @note    The first occurrence of a duplicate key is kept.
+ */
+template<class K, class V, class Hash, class Equal>
+template<class InputIterator, class>
+FlatHashMap<K, V, Hash, Equal>::FlatHashMap(InputIterator begin, InputIterator end)
+{
+    if constexpr(std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>::value)
+        table.Reserve(std::distance(begin, end));
+
+    for(; begin != end; ++begin)
+        Insert(begin->first, begin->second);
+}
+
+/**
+ * @brief   Bulk construction from the pairs of an array.
+ * @param   array   Source array, the first occurrence of a duplicate key is kept
+ */
+template<class K, class V, class Hash, class Equal>
+FlatHashMap<K, V, Hash, Equal>::FlatHashMap(const Array<Entry>& array)
+: FlatHashMap(array.begin(), array.end())
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Bulk construction from the pairs of a list.
+ * @param   list    Source list, the first occurrence of a duplicate key is kept
+ */
+template<class K, class V, class Hash, class Equal>
+FlatHashMap<K, V, Hash, Equal>::FlatHashMap(List<Entry>& list)
+{
+    if(list.isEmpty() == true)
+        return;
+
+    table.Reserve(list.GetNodeCount());
+
+    auto it = list.begin();
+    for(size_t index = 0; index < list.GetNodeCount(); index++, it++)
+        Insert((*it).first, (*it).second);
+}
+
+/**
+ * @brief   Constructs from the pairs of the initializer list.
+ * @param   initializerList Source pairs, the first occurrence of a duplicate key is kept
+ */
+template<class K, class V, class Hash, class Equal>
+FlatHashMap<K, V, Hash, Equal>::FlatHashMap(std::initializer_list<Entry> initializerList)
+: FlatHashMap(initializerList.begin(), initializerList.end())
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Searches a key.
+ * @param   key Search key
+ * @return  Address of the value of the key, nullptr if the key is absent.
+ */
+template<class K, class V, class Hash, class Equal>
+const V* FlatHashMap<K, V, Hash, Equal>::Find(const K& key) const
+{
+    const Entry* entry = table.Find(key);
+    return (entry != nullptr) ? &entry->second : nullptr;
+}
+
+/**
+ * @brief   Searches a key.
+ * @param   key Search key
+ * @return  Address of the value of the key, nullptr if the key is absent.
+ */
+template<class K, class V, class Hash, class Equal>
+V* FlatHashMap<K, V, Hash, Equal>::Find(const K& key)
+{
+    Entry* entry = table.Find(key);
+    return (entry != nullptr) ? &entry->second : nullptr;
+}
+
+/**
+ * @brief   Searches a key by a value comparable to the keys, e.g. a string_view for string keys.
+ * @param   query   Search key
+ * @return  Address of the value of the key, nullptr if the key is absent.
+ */
+template<class K, class V, class Hash, class Equal>
+template<class Query, class>
+const V* FlatHashMap<K, V, Hash, Equal>::Find(const Query& query) const
+{
+    const Entry* entry = table.Find(query);
+    return (entry != nullptr) ? &entry->second : nullptr;
+}
+
+/**
+ * @brief   Value access by the key.
+ * @param   key Search key
+ * @return  rValue reference to the value of the key.
+ * @throws  std::logic_error If the key is absent
+ */
+template<class K, class V, class Hash, class Equal>
+const V& FlatHashMap<K, V, Hash, Equal>::At(const K& key) const
+{
+    const V* value = Find(key);
+
+    if(value == nullptr)
+        throw std::logic_error("Key not found!");
+
+    return *value;
+}
+
+/**
+ * @brief   Value access by the key.
+ * @param   key Search key
+ * @return  lValue reference to the value of the key.
+ * @throws  std::logic_error If the key is absent
+ */
+template<class K, class V, class Hash, class Equal>
+V& FlatHashMap<K, V, Hash, Equal>::At(const K& key)
+{
+    V* value = Find(key);
+
+    if(value == nullptr)
+        throw std::logic_error("Key not found!");
+
+    return *value;
+}
+
+/**
+ * @brief   Value access by the key, inserting a default constructed value if the key is absent.
+ * @param   key Search key
+ * @return  lValue reference to the value of the key.
+ */
+template<class K, class V, class Hash, class Equal>
+V& FlatHashMap<K, V, Hash, Equal>::operator[](const K& key)
+{
+    return table.Insert(Entry(key, V())).first->second;
+}
+
+/**
+ * @brief   Adds a pair or replaces the value of an existing key.
+ * @param   key     Key of the pair
+ * @param   value   Value of the pair
+ * @return  true If the pair was added, false if an existing value was replaced.
+ */
+template<class K, class V, class Hash, class Equal>
+bool FlatHashMap<K, V, Hash, Equal>::InsertOrAssign(const K& key, const V& value)
+{
+    const std::pair<Entry*, bool> result = table.Insert(Entry(key, value));
+
+    if(result.second == false)
+        result.first->second = value;
+
+    return result.second;
+}
+
+/**
+ * @brief   Visits the pairs.
+ * @param   callable    Called as callable(key, value) for each pair
+ */
+template<class K, class V, class Hash, class Equal>
+template<class CallableType>
+void FlatHashMap<K, V, Hash, Equal>::ForEach(CallableType callable) const
+{
+    table.ForEach([&](const Entry& entry) { callable(entry.first, entry.second); });
+}
+
+#endif  // Prevent recursive inclusion
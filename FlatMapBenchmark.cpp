@@ -0,0 +1,182 @@
+// Description: Lookup latency, build time and memory of FlatMap against node based maps and sorted Lists
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 FlatMapBenchmark.cpp -o FlatMapBenchmark
+// Usage:       ./FlatMapBenchmark [lookups]
+//              (default: 1000000, half of them miss)
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <random>
+#include <utility>
+#include <cstdint>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "FlatMapContainer.h"
+#include "ListContainer.h"
+
+using namespace std;
+
+static const size_t repetitions = 3;
+
+using Key   = uint64_t;
+using Value = uint64_t;
+using Pair  = pair<Key, Value>;
+
+// Standard allocator counting the live bytes, so the nodes of the standard maps can be measured
+static size_t countedBytes = 0;
+
+template<class T>
+struct CountingAllocator{
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template<class U> CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(const size_t count)
+    {
+        countedBytes += count * sizeof(T);
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, const size_t count)
+    {
+        countedBytes -= count * sizeof(T);
+        ::operator delete(pointer);
+    }
+
+    template<class U> bool operator==(const CountingAllocator<U>&) const { return true;  }
+    template<class U> bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+using TreeMap = map<Key, Value, less<Key>, CountingAllocator<pair<const Key, Value>>>;
+using HashMap = unordered_map<Key, Value, hash<Key>, equal_to<Key>, CountingAllocator<pair<const Key, Value>>>;
+
+// Linear search of the sorted list, stops at the first greater key
+static const Value* FindInList(List<Pair>& list, const Key key)
+{
+    auto it = list.begin();
+
+    for(size_t index = 0; index < list.GetNodeCount(); index++, it++)
+    {
+        if((*it).first >= key)
+            return ((*it).first == key) ? &(*it).second : nullptr;
+    }
+
+    return nullptr;
+}
+
+// Measures the average time of a lookup over the probe keys
+template<class FindType>
+static double LookupNanoseconds(const vector<Key>& probes, FindType find)
+{
+    const double seconds = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        uint64_t sum = 0;
+
+        for(const Key key : probes)
+        {
+            const Value* value = find(key);
+            sum += (value != nullptr) ? *value : 1;
+        }
+
+        Benchmark::DoNotOptimize(sum);
+    });
+
+    return seconds * 1e9 / probes.size();
+}
+
+static void PrintRow(const string& container, const size_t size, const double buildMs, const double lookupNs, const size_t bytes)
+{
+    cout << setw(16) << left << container << right << setw(10) << size
+         << setw(12) << fixed << setprecision(2) << buildMs
+         << setw(12) << lookupNs
+         << setw(12) << setprecision(1) << static_cast<double>(bytes) / size << endl;
+}
+
+static void RunSuite(const size_t size, const size_t lookups, mt19937_64& generator)
+{
+    // Even keys are stored, odd probes miss
+    vector<Pair> pairs(size);
+    for(size_t index = 0; index < size; index++)
+        pairs[index] = Pair(generator() & ~1ull, index);
+
+    vector<Key> probes(lookups);
+    for(size_t index = 0; index < lookups; index++)
+        probes[index] = (index % 2 == 0) ? pairs[generator() % size].first : (generator() | 1);
+
+    // Bulk build of the flat map against one by one insertions into the node based maps
+    FlatMap<Key, Value> flat;
+    const double flatBuild = Benchmark::MeasureBest(repetitions,
+        [&]() { flat.EraseAll(); },
+        [&]() { flat.InsertBatch(pairs.begin(), pairs.end()); });
+    flat.ShrinkToFit();
+
+    TreeMap tree;
+    const double treeBuild = Benchmark::MeasureBest(repetitions,
+        [&]() { tree.clear(); },
+        [&]() { for(const Pair& pair : pairs) tree.insert(pair); });
+
+    HashMap hashed;
+    const double hashBuild = Benchmark::MeasureBest(repetitions,
+        [&]() { hashed = HashMap(); },
+        [&]() { for(const Pair& pair : pairs) hashed.insert(pair); });
+
+    countedBytes = 0;
+    {
+        TreeMap measured(pairs.begin(), pairs.end());
+        const size_t treeBytes = countedBytes + sizeof(measured);
+
+        PrintRow("FlatMap", size, flatBuild * 1000, LookupNanoseconds(probes, [&](const Key key) { return flat.Find(key); }), flat.GetMemoryBytes());
+        PrintRow("std::map", size, treeBuild * 1000, LookupNanoseconds(probes, [&](const Key key)
+        {
+            const auto it = tree.find(key);
+            return (it != tree.end()) ? &it->second : nullptr;
+        }), treeBytes);
+    }
+
+    countedBytes = 0;
+    {
+        HashMap measured(pairs.begin(), pairs.end());
+        const size_t hashBytes = countedBytes + sizeof(measured);
+
+        PrintRow("std::unordered", size, hashBuild * 1000, LookupNanoseconds(probes, [&](const Key key)
+        {
+            const auto it = hashed.find(key);
+            return (it != hashed.end()) ? &it->second : nullptr;
+        }), hashBytes);
+    }
+
+    // The sorted list is searched linearly, only the small sizes finish in a reasonable time
+    if(size <= 4096)
+    {
+        vector<Pair> sorted;
+        flat.ForEach([&](const Key key, const Value value) { sorted.emplace_back(key, value); });
+
+        List<Pair> list(sorted.begin(), sorted.end());
+        const vector<Key> fewProbes(probes.begin(), probes.begin() + min<size_t>(probes.size(), 20000));
+
+        PrintRow("sorted List", size, 0, LookupNanoseconds(fewProbes, [&](const Key key) { return FindInList(list, key); }),
+                 list.GetNodeCount() * sizeof(ListNode<Pair>) + sizeof(list));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t lookups = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+    mt19937_64 generator(42);
+
+    cout << setw(16) << left << "container" << right << setw(10) << "size" << setw(12) << "build ms"
+         << setw(12) << "lookup ns" << setw(12) << "bytes/pair" << endl;
+
+    for(const size_t size : {1ul << 10, 1ul << 12, 1ul << 16, 1ul << 20})
+        RunSuite(size, lookups, generator);
+
+    return 0;
+}
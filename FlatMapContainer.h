@@ -0,0 +1,943 @@
+/** @file       FlatMapContainer.h
+ *  @details    Sorted associative containers over contiguous Array buffers.
+ *              FlatMap keeps its keys and its values in two parallel arrays sorted by the key, FlatSet
+ *              keeps only the keys. Lookups run a branch-free binary search over the key array, which
+ *              touches a handful of cache lines instead of chasing one pointer per tree level.
+ *              They suit read-mostly tables: a single insertion shifts the tail of the arrays, while
+ *              a batch of insertions is sorted and merged in one linear pass.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       The buffers are Array instances, so the key and value types must be default constructible and assignable.
+ *  @note       Insertions and removals invalidate the pointers returned by Find.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef FLAT_MAP_CONTAINER_H
+#define FLAT_MAP_CONTAINER_H
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <stdexcept>
+#include <cstddef>
+
+#include "ArrayContainer.h"
+
+/**
+ * @brief   Branch-free lower bound over a sorted key range.
+ * @param   keys    Sorted keys
+ * @param   count   Number of keys
+ * @param   key     Search key
+ * @param   compare Strict weak ordering of the keys
+ * @return  Index of the first key not less than the search key, count if there is none.
+ * @note    The loop runs exactly log2(count) times whatever the keys are, the halving is a conditional
+ *          move, so the branch predictor cannot miss on it.
+ */
+template<class K, class Compare>
+size_t FlatLowerBound(const K* keys, const size_t count, const K& key, const Compare& compare)
+{
+    if(count == 0)
+        return 0;
+
+    const K* base = keys;
+    size_t length = count;
+
+    while(length > 1)
+    {
+        const size_t half = length / 2;
+        base = compare(base[half - 1], key) ? (base + half) : base;
+        length -= half;
+    }
+
+    return (base - keys) + (compare(*base, key) ? 1 : 0);
+}
+
+/**
+ * @brief   Sorts a batch by the key and removes its duplicates in place.
+ * @param   batch   Elements to be sorted
+ * @param   getKey  Reaches the key of an element
+ * @param   compare Strict weak ordering of the keys
+ * @note    The sort is stable, so the first occurrence of a duplicate key is the one kept.
+ */
+template<class ElementType, class KeyAccess, class Compare>
+void FlatSortUnique(std::vector<ElementType>& batch, const KeyAccess& getKey, const Compare& compare)
+{
+    std::stable_sort(batch.begin(), batch.end(), [&](const ElementType& left, const ElementType& right)
+                     { return compare(getKey(left), getKey(right)); });
+
+    size_t kept = 0;
+
+    for(size_t index = 0; index < batch.size(); index++)
+    {
+        if((kept != 0) && (compare(getKey(batch[kept - 1]), getKey(batch[index])) == false))
+            continue;   // Equal to the last kept key
+
+        if(kept != index)
+            batch[kept] = std::move(batch[index]);
+
+        kept++;
+    }
+
+    batch.erase(batch.begin() + kept, batch.end());
+}
+
+template<class K, class V, class Compare = std::less<K>>
+class FlatMap{
+public:
+    /*** Constructors and Destructors ***/
+    FlatMap();                                          // Default constructor
+    FlatMap(const FlatMap& anotherMap);                 // Copy constructor
+    FlatMap(FlatMap&& anotherMap);                      // Move constructor
+    FlatMap(std::initializer_list<std::pair<K, V>> initializerList);
+
+    template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+    FlatMap(InputIterator begin, InputIterator end);    // Bulk build from an unsorted range of pairs
+
+    virtual ~FlatMap();     // Destructor
+
+    const FlatMap& operator=(const FlatMap& rightMap);  // Map assignment
+
+    /*** Lookup ***/
+    const V* Find(const K& key) const;      // Address of the value, nullptr if the key is absent
+    V* Find(const K& key);
+    bool Contains(const K& key) const { return (Find(key) != nullptr); }
+    const V& At(const K& key) const;        // Value of the key, throws if the key is absent
+    V& At(const K& key);
+    V& operator[](const K& key);            // Value of the key, inserted as default constructed if absent
+
+    /*** Modifiers ***/
+    bool Insert(const K& key, const V& value);  // Adds the pair if the key is absent
+
+    template<class InputIterator>
+    size_t InsertBatch(InputIterator begin, InputIterator end);     // Adds the pairs of absent keys in one merge
+
+    bool Erase(const K& key);               // Removes the pair of the key
+    void EraseAll();                        // Removes all pairs and releases the buffers
+    void Reserve(const size_t capacity);    // Makes room for the given number of pairs
+    void ShrinkToFit();                     // Releases the unused capacity
+    void Swap(FlatMap& anotherMap);         // Exchanges the content of two maps
+
+    /*** Status Checkers ***/
+    bool isEmpty() const            { return (count == 0); }
+    size_t getSize() const          { return count; }
+    size_t GetCapacity() const      { return (keys == nullptr) ? 0 : keys->getSize(); }
+    size_t GetMemoryBytes() const   { return sizeof(*this) + GetCapacity() * (sizeof(K) + sizeof(V)); }
+
+    /*** Ordered Access ***/
+    const K& KeyAt(const size_t index) const;   // Key at the given rank
+    const V& ValueAt(const size_t index) const; // Value at the given rank
+    V& ValueAt(const size_t index);
+
+    template<class CallableType>
+    void ForEach(CallableType callable) const;  // Calls callable(key, value) in the key order
+
+private:
+    using Element = std::pair<K, V>;
+
+    size_t LowerBound(const K& key) const;      // Rank of the first key not less than the given one
+    bool Matches(const size_t index, const K& key) const;
+    void Reallocate(const size_t capacity);     // Moves the pairs into buffers of the given capacity
+    void ThrowOutOfRange(const size_t index) const;
+    void MergeSorted(std::vector<Element>& batch, const size_t newKeys);   // Merges a sorted batch of unique keys
+
+    Array<K>* keys      = nullptr;  // Sorted keys, nullptr until the first insertion
+    Array<V>* values    = nullptr;  // Values in the order of their keys
+    size_t count        = 0;        // Number of pairs in use
+    Compare compare;                // Key ordering
+};
+
+
+/**
+ * @brief   Default constructor, no buffer is allocated until the first insertion.
+ */
+template<class K, class V, class Compare>
+FlatMap<K, V, Compare>::FlatMap()
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Copy constructor
+ * @param   anotherMap  Source map
+ */
+template<class K, class V, class Compare>
+FlatMap<K, V, Compare>::FlatMap(const FlatMap& anotherMap)
+: compare(anotherMap.compare)
+{
+    Reserve(anotherMap.count);
+
+    for(size_t index = 0; index < anotherMap.count; index++)
+    {
+        keys->begin()[index]    = anotherMap.keys->begin()[index];
+        values->begin()[index]  = anotherMap.values->begin()[index];
+    }
+
+    count = anotherMap.count;
+}
+
+/**
+ * @brief   Move constructor, takes over the buffers of the source map.
+ * @param   anotherMap  Source map, left empty
+ */
+template<class K, class V, class Compare>
+FlatMap<K, V, Compare>::FlatMap(FlatMap&& anotherMap)
+{
+    Swap(anotherMap);
+}
+
+/**
+ * @brief   Constructs from an unsorted list of pairs.
+ * @param   initializerList Pairs, the first occurrence of a duplicate key is kept
+ */
+template<class K, class V, class Compare>
+FlatMap<K, V, Compare>::FlatMap(std::initializer_list<std::pair<K, V>> initializerList)
+: FlatMap(initializerList.begin(), initializerList.end())
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Bulk build, sorts the pairs and drops the duplicates in one pass.
+ * @param   begin   First pair of the range
+ * @param   end     End of the half-open range
+ * @note    The first occurrence of a duplicate key is kept, as if the pairs were inserted one by one.
+ */
+template<class K, class V, class Compare>
+template<class InputIterator, class>
+FlatMap<K, V, Compare>::FlatMap(InputIterator begin, InputIterator end)
+{
+    InsertBatch(begin, end);
+}
+
+/**
+ * @brief   Destructor
+ */
+template<class K, class V, class Compare>
+FlatMap<K, V, Compare>::~FlatMap()
+{
+    delete keys;
+    delete values;
+}
+
+/**
+ * @brief   Replaces the content by a copy of another map.
+ * @param   rightMap    Source map
+ * @return  rValue reference to the current map to support cascaded assignments
+ */
+template<class K, class V, class Compare>
+const FlatMap<K, V, Compare>& FlatMap<K, V, Compare>::operator=(const FlatMap& rightMap)
+{
+    if(this != &rightMap)
+    {
+        FlatMap copy(rightMap);
+        Swap(copy);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Searches a key.
+ * @param   key Search key
+ * @return  Address of the value of the key, nullptr if the key is absent.
+ */
+template<class K, class V, class Compare>
+const V* FlatMap<K, V, Compare>::Find(const K& key) const
+{
+    const size_t index = LowerBound(key);
+    return Matches(index, key) ? (values->begin() + index) : nullptr;
+}
+
+/**
+ * @brief   Searches a key.
+ * @param   key Search key
+ * @return  Address of the value of the key, nullptr if the key is absent.
+ */
+template<class K, class V, class Compare>
+V* FlatMap<K, V, Compare>::Find(const K& key)
+{
+    const size_t index = LowerBound(key);
+    return Matches(index, key) ? (values->begin() + index) : nullptr;
+}
+
+/**
+ * @brief   Value access by the key.
+ * @param   key Search key
+ * @return  rValue reference to the value of the key.
+ * @throws  std::logic_error If the key is absent
+ */
+template<class K, class V, class Compare>
+const V& FlatMap<K, V, Compare>::At(const K& key) const
+{
+    const V* value = Find(key);
+
+    if(value == nullptr)
+        throw std::logic_error("Key not found!");
+
+    return *value;
+}
+
+/**
+ * @brief   Value access by the key.
+ * @param   key Search key
+ * @return  lValue reference to the value of the key.
+ * @throws  std::logic_error If the key is absent
+ */
+template<class K, class V, class Compare>
+V& FlatMap<K, V, Compare>::At(const K& key)
+{
+    V* value = Find(key);
+
+    if(value == nullptr)
+        throw std::logic_error("Key not found!");
+
+    return *value;
+}
+
+/**
+ * @brief   Value access by the key, inserting a default constructed value if the key is absent.
+ * @param   key Search key
+ * @return  lValue reference to the value of the key.
+ */
+template<class K, class V, class Compare>
+V& FlatMap<K, V, Compare>::operator[](const K& key)
+{
+    Insert(key, V());   // Does nothing if the key exists
+    return *Find(key);
+}
+
+/**
+ * @brief   Adds a pair, shifting the greater keys by one.
+ * @param   key     Key of the pair
+ * @param   value   Value of the pair
+ * @return  true    If the pair was added.
+ *          false   If the key already exists, its value is left unchanged.
+ * @note    O(n) per call, prefer InsertBatch for many pairs.
+ */
+template<class K, class V, class Compare>
+bool FlatMap<K, V, Compare>::Insert(const K& key, const V& value)
+{
+    const size_t index = LowerBound(key);
+
+    if(Matches(index, key) == true)
+        return false;
+
+    if(count == GetCapacity())
+        Reallocate((count < 8) ? 16 : count * 2);
+
+    K* const keyBuffer      = keys->begin();
+    V* const valueBuffer    = values->begin();
+
+    std::move_backward(keyBuffer + index, keyBuffer + count, keyBuffer + count + 1);
+    std::move_backward(valueBuffer + index, valueBuffer + count, valueBuffer + count + 1);
+
+    keyBuffer[index]    = key;
+    valueBuffer[index]  = value;
+    count++;
+
+    return true;
+}
+
+/**
+ * @brief   Adds many pairs at once, the batch is sorted and merged with the current pairs in one pass.
+ * @param   begin   First pair of the range, in any order
+ * @param   end     End of the half-open range
+ * @return  Number of pairs added.
+ * @note    Keys already in the map and repeated keys of the batch keep their first value.
+ *          The merge runs in place, from the back, when the capacity is enough.
+ */
+template<class K, class V, class Compare>
+template<class InputIterator>
+size_t FlatMap<K, V, Compare>::InsertBatch(InputIterator begin, InputIterator end)
+{
+    std::vector<Element> batch;
+    for(; begin != end; ++begin)
+        batch.emplace_back(begin->first, begin->second);
+
+    FlatSortUnique(batch, [](const Element& element) -> const K& { return element.first; }, compare);
+
+    // Counting pass, the batch keys which are already in the map are not inserted
+    size_t newKeys = 0;
+    for(size_t current = 0, index = 0; index < batch.size(); index++)
+    {
+        while((current < count) && compare(keys->begin()[current], batch[index].first))
+            current++;
+
+        if((current == count) || compare(batch[index].first, keys->begin()[current]))
+            newKeys++;
+    }
+
+    if(newKeys != 0)
+        MergeSorted(batch, newKeys);
+
+    return newKeys;
+}
+
+/**
+ * @brief   Removes a pair, shifting the greater keys by one.
+ * @param   key Key of the pair
+ * @return  true If the key was found and removed.
+ */
+template<class K, class V, class Compare>
+bool FlatMap<K, V, Compare>::Erase(const K& key)
+{
+    const size_t index = LowerBound(key);
+
+    if(Matches(index, key) == false)
+        return false;
+
+    K* const keyBuffer      = keys->begin();
+    V* const valueBuffer    = values->begin();
+
+    std::move(keyBuffer + index + 1, keyBuffer + count, keyBuffer + index);
+    std::move(valueBuffer + index + 1, valueBuffer + count, valueBuffer + index);
+    count--;
+
+    keyBuffer[count]    = K();  // Releases the resources of the vacated slots
+    valueBuffer[count]  = V();
+
+    return true;
+}
+
+/**
+ * @brief   Removes all pairs and frees the buffers.
+ */
+template<class K, class V, class Compare>
+void FlatMap<K, V, Compare>::EraseAll()
+{
+    delete keys;
+    delete values;
+
+    keys    = nullptr;
+    values  = nullptr;
+    count   = 0;
+}
+
+/**
+ * @brief   Grows the buffers so that the given number of pairs fits without a reallocation.
+ * @param   capacity    Number of pairs
+ */
+template<class K, class V, class Compare>
+void FlatMap<K, V, Compare>::Reserve(const size_t capacity)
+{
+    if(capacity > GetCapacity())
+        Reallocate(capacity);
+}
+
+/**
+ * @brief   Shrinks the buffers to the number of pairs.
+ */
+template<class K, class V, class Compare>
+void FlatMap<K, V, Compare>::ShrinkToFit()
+{
+    if(count == 0)
+        EraseAll();
+    else if(count < GetCapacity())
+        Reallocate(count);
+    else;
+}
+
+/**
+ * @brief   Exchanges the content of two maps, no pair is copied.
+ * @param   anotherMap  Map to be swapped with
+ */
+template<class K, class V, class Compare>
+void FlatMap<K, V, Compare>::Swap(FlatMap& anotherMap)
+{
+    std::swap(keys,     anotherMap.keys);
+    std::swap(values,   anotherMap.values);
+    std::swap(count,    anotherMap.count);
+    std::swap(compare,  anotherMap.compare);
+}
+
+/**
+ * @brief   Key access by the rank.
+ * @param   index   Rank of the key, zero for the smallest one
+ * @return  rValue reference to the key.
+ * @throws  std::range_error When given index is out of map range
+ */
+template<class K, class V, class Compare>
+const K& FlatMap<K, V, Compare>::KeyAt(const size_t index) const
+{
+    if(index >= count)
+        ThrowOutOfRange(index);
+
+    return keys->begin()[index];
+}
+
+/**
+ * @brief   Value access by the rank.
+ * @param   index   Rank of the key of the value, zero for the smallest one
+ * @return  rValue reference to the value.
+ * @throws  std::range_error When given index is out of map range
+ */
+template<class K, class V, class Compare>
+const V& FlatMap<K, V, Compare>::ValueAt(const size_t index) const
+{
+    if(index >= count)
+        ThrowOutOfRange(index);
+
+    return values->begin()[index];
+}
+
+/**
+ * @brief   Value access by the rank.
+ * @param   index   Rank of the key of the value, zero for the smallest one
+ * @return  lValue reference to the value.
+ * @throws  std::range_error When given index is out of map range
+ */
+template<class K, class V, class Compare>
+V& FlatMap<K, V, Compare>::ValueAt(const size_t index)
+{
+    if(index >= count)
+        ThrowOutOfRange(index);
+
+    return values->begin()[index];
+}
+
+/**
+ * @brief   Visits the pairs in the key order.
+ * @param   callable    Called as callable(key, value) for each pair
+ */
+template<class K, class V, class Compare>
+template<class CallableType>
+void FlatMap<K, V, Compare>::ForEach(CallableType callable) const
+{
+    for(size_t index = 0; index < count; index++)
+        callable(keys->begin()[index], values->begin()[index]);
+}
+
+/**
+ * @brief   Rank of the first key which is not less than the given one.
+ * @param   key Search key
+ * @return  Index into the buffers, count if all keys are less.
+ */
+template<class K, class V, class Compare>
+size_t FlatMap<K, V, Compare>::LowerBound(const K& key) const
+{
+    return (count == 0) ? 0 : FlatLowerBound(keys->begin(), count, key, compare);
+}
+
+/**
+ * @brief   Checks whether the key at the given rank equals the search key.
+ * @param   index   Result of LowerBound
+ * @param   key     Search key
+ * @return  true If the key exists at that rank.
+ */
+template<class K, class V, class Compare>
+bool FlatMap<K, V, Compare>::Matches(const size_t index, const K& key) const
+{
+    return (index < count) && (compare(key, keys->begin()[index]) == false);
+}
+
+/**
+ * @brief   Moves the pairs into new buffers.
+ * @param   capacity    Number of pairs of the new buffers, not less than the pair count
+ */
+template<class K, class V, class Compare>
+void FlatMap<K, V, Compare>::Reallocate(const size_t capacity)
+{
+    Array<K>* newKeys   = new Array<K>(capacity);
+    Array<V>* newValues = nullptr;
+
+    try
+    {
+        newValues = new Array<V>(capacity);
+    }
+    catch(...)
+    {
+        delete newKeys;
+        throw;
+    }
+
+    for(size_t index = 0; index < count; index++)
+    {
+        newKeys->begin()[index]     = std::move(keys->begin()[index]);
+        newValues->begin()[index]   = std::move(values->begin()[index]);
+    }
+
+    delete keys;
+    delete values;
+
+    keys    = newKeys;
+    values  = newValues;
+}
+
+/**
+ * @brief   Throws an exception with the related information messages.
+ * @param   index   Index of the failed access
+ * @throws  std::range_error Always
+ */
+template<class K, class V, class Compare>
+void FlatMap<K, V, Compare>::ThrowOutOfRange(const size_t index) const
+{
+    std::string errorMessage = "Out-of-Range Exception Occured ";
+                errorMessage += "(Size = "  + std::to_string(count) + ") ";
+                errorMessage += "(Index = " + std::to_string(index) + ") ";
+    throw std::range_error(errorMessage);
+}
+
+/**
+ * @brief   Merges a sorted batch of unique keys into the buffers.
+ * @param   batch   Sorted pairs without duplicate keys, consumed
+ * @param   newKeys Number of batch keys which are not in the map yet
+ * @note    Merges from the back so that no pair is overwritten before it is moved,
+ *          the buffers grow first if the merged pairs don't fit.
+ */
+template<class K, class V, class Compare>
+void FlatMap<K, V, Compare>::MergeSorted(std::vector<Element>& batch, const size_t newKeys)
+{
+    const size_t mergedCount = count + newKeys;
+
+    if(mergedCount > GetCapacity())
+        Reallocate(std::max(mergedCount, GetCapacity() * 2));
+
+    K* const keyBuffer      = keys->begin();
+    V* const valueBuffer    = values->begin();
+
+    size_t write    = mergedCount;  // One past the slot written next
+    size_t current  = count;        // One past the next pair of the map
+    size_t incoming = batch.size(); // One past the next pair of the batch
+
+    while(write != current)     // Equal once the new keys are placed, the rest of the map is already in place
+    {
+        Element& element = batch[incoming - 1];
+
+        if((current > 0) && compare(element.first, keyBuffer[current - 1]))     // The map key is greater
+        {
+            write--;
+            current--;
+            keyBuffer[write]    = std::move(keyBuffer[current]);
+            valueBuffer[write]  = std::move(valueBuffer[current]);
+        }
+        else if((current > 0) && (compare(keyBuffer[current - 1], element.first) == false))    // Already in the map
+            incoming--;
+        else
+        {
+            write--;
+            incoming--;
+            keyBuffer[write]    = std::move(element.first);
+            valueBuffer[write]  = std::move(element.second);
+        }
+    }
+
+    count = mergedCount;
+}
+
+
+template<class K, class Compare = std::less<K>>
+class FlatSet{
+public:
+    /*** Constructors and Destructors ***/
+    FlatSet();                                          // Default constructor
+    FlatSet(const FlatSet& anotherSet);                 // Copy constructor
+    FlatSet(FlatSet&& anotherSet);                      // Move constructor
+    FlatSet(std::initializer_list<K> initializerList);
+
+    template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+    FlatSet(InputIterator begin, InputIterator end);    // Bulk build from an unsorted range of keys
+
+    virtual ~FlatSet();     // Destructor
+
+    const FlatSet& operator=(const FlatSet& rightSet);  // Set assignment
+
+    /*** Lookup ***/
+    bool Contains(const K& key) const;
+    size_t Rank(const K& key) const     { return LowerBound(key); }     // Number of keys less than the given one
+
+    /*** Modifiers ***/
+    bool Insert(const K& key);          // Adds the key if it is absent
+
+    template<class InputIterator>
+    size_t InsertBatch(InputIterator begin, InputIterator end);     // Adds the absent keys in one merge
+
+    bool Erase(const K& key);           // Removes the key
+    void EraseAll();                    // Removes all keys and releases the buffer
+    void Reserve(const size_t capacity);
+    void ShrinkToFit();
+    void Swap(FlatSet& anotherSet);
+
+    /*** Status Checkers ***/
+    bool isEmpty() const            { return (count == 0); }
+    size_t getSize() const          { return count; }
+    size_t GetCapacity() const      { return (keys == nullptr) ? 0 : keys->getSize(); }
+    size_t GetMemoryBytes() const   { return sizeof(*this) + GetCapacity() * sizeof(K); }
+
+    /*** Iterators ***/
+    // Raw pointers are used as iterators since the keys are contiguous, the keys must not be modified
+    const K* begin() const  { return (keys == nullptr) ? nullptr : keys->begin();         }
+    const K* end() const    { return (keys == nullptr) ? nullptr : keys->begin() + count; }
+
+private:
+    size_t LowerBound(const K& key) const;
+    void Reallocate(const size_t capacity);
+
+    Array<K>* keys  = nullptr;  // Sorted keys, nullptr until the first insertion
+    size_t count    = 0;        // Number of keys in use
+    Compare compare;            // Key ordering
+};
+
+
+/**
+ * @brief   Default constructor, no buffer is allocated until the first insertion.
+ */
+template<class K, class Compare>
+FlatSet<K, Compare>::FlatSet()
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Copy constructor
+ * @param   anotherSet  Source set
+ */
+template<class K, class Compare>
+FlatSet<K, Compare>::FlatSet(const FlatSet& anotherSet)
+: compare(anotherSet.compare)
+{
+    if(anotherSet.count == 0)
+        return;
+
+    Reserve(anotherSet.count);
+    std::copy(anotherSet.begin(), anotherSet.end(), keys->begin());
+    count = anotherSet.count;
+}
+
+/**
+ * @brief   Move constructor, takes over the buffer of the source set.
+ * @param   anotherSet  Source set, left empty
+ */
+template<class K, class Compare>
+FlatSet<K, Compare>::FlatSet(FlatSet&& anotherSet)
+{
+    Swap(anotherSet);
+}
+
+/**
+ * @brief   Constructs from an unsorted list of keys.
+ * @param   initializerList Keys, duplicates are dropped
+ */
+template<class K, class Compare>
+FlatSet<K, Compare>::FlatSet(std::initializer_list<K> initializerList)
+: FlatSet(initializerList.begin(), initializerList.end())
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Bulk build, sorts the keys and drops the duplicates in one pass.
+ * @param   begin   First key of the range
+ * @param   end     End of the half-open range
+ */
+template<class K, class Compare>
+template<class InputIterator, class>
+FlatSet<K, Compare>::FlatSet(InputIterator begin, InputIterator end)
+{
+    InsertBatch(begin, end);
+}
+
+/**
+ * @brief   Destructor
+ */
+template<class K, class Compare>
+FlatSet<K, Compare>::~FlatSet()
+{
+    delete keys;
+}
+
+/**
+ * @brief   Replaces the content by a copy of another set.
+ * @param   rightSet    Source set
+ * @return  rValue reference to the current set to support cascaded assignments
+ */
+template<class K, class Compare>
+const FlatSet<K, Compare>& FlatSet<K, Compare>::operator=(const FlatSet& rightSet)
+{
+    if(this != &rightSet)
+    {
+        FlatSet copy(rightSet);
+        Swap(copy);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Searches a key.
+ * @param   key Search key
+ * @return  true If the key is in the set.
+ */
+template<class K, class Compare>
+bool FlatSet<K, Compare>::Contains(const K& key) const
+{
+    const size_t index = LowerBound(key);
+    return (index < count) && (compare(key, keys->begin()[index]) == false);
+}
+
+/**
+ * @brief   Adds a key, shifting the greater keys by one.
+ * @param   key Key to be added
+ * @return  true If the key was added, false if it already exists.
+ * @note    O(n) per call, prefer InsertBatch for many keys.
+ */
+template<class K, class Compare>
+bool FlatSet<K, Compare>::Insert(const K& key)
+{
+    const size_t index = LowerBound(key);
+
+    if((index < count) && (compare(key, keys->begin()[index]) == false))
+        return false;
+
+    if(count == GetCapacity())
+        Reallocate((count < 8) ? 16 : count * 2);
+
+    K* const keyBuffer = keys->begin();
+    std::move_backward(keyBuffer + index, keyBuffer + count, keyBuffer + count + 1);
+    keyBuffer[index] = key;
+    count++;
+
+    return true;
+}
+
+/**
+ * @brief   Adds many keys at once, the batch is sorted and merged with the current keys in one pass.
+ * @param   begin   First key of the range, in any order
+ * @param   end     End of the half-open range
+ * @return  Number of keys added.
+ */
+template<class K, class Compare>
+template<class InputIterator>
+size_t FlatSet<K, Compare>::InsertBatch(InputIterator begin, InputIterator end)
+{
+    std::vector<K> batch(begin, end);
+    FlatSortUnique(batch, [](const K& key) -> const K& { return key; }, compare);
+
+    // Counting pass, the batch keys which are already in the set are not inserted
+    size_t newKeys = 0;
+    for(size_t current = 0, index = 0; index < batch.size(); index++)
+    {
+        while((current < count) && compare(keys->begin()[current], batch[index]))
+            current++;
+
+        if((current == count) || compare(batch[index], keys->begin()[current]))
+            newKeys++;
+    }
+
+    if(newKeys == 0)
+        return 0;
+
+    const size_t mergedCount = count + newKeys;
+
+    if(mergedCount > GetCapacity())
+        Reallocate(std::max(mergedCount, GetCapacity() * 2));
+
+    // Merges from the back so that no key is overwritten before it is moved
+    K* const keyBuffer = keys->begin();
+    size_t write = mergedCount, current = count, incoming = batch.size();
+
+    while(write != current)     // Equal once the new keys are placed
+    {
+        if((current > 0) && compare(batch[incoming - 1], keyBuffer[current - 1]))
+            keyBuffer[--write] = std::move(keyBuffer[--current]);
+        else if((current > 0) && (compare(keyBuffer[current - 1], batch[incoming - 1]) == false))
+            incoming--;     // Already in the set
+        else
+            keyBuffer[--write] = std::move(batch[--incoming]);
+    }
+
+    count = mergedCount;
+    return newKeys;
+}
+
+/**
+ * @brief   Removes a key, shifting the greater keys by one.
+ * @param   key Key to be removed
+ * @return  true If the key was found and removed.
+ */
+template<class K, class Compare>
+bool FlatSet<K, Compare>::Erase(const K& key)
+{
+    const size_t index = LowerBound(key);
+
+    if((index >= count) || compare(key, keys->begin()[index]))
+        return false;
+
+    K* const keyBuffer = keys->begin();
+    std::move(keyBuffer + index + 1, keyBuffer + count, keyBuffer + index);
+    count--;
+    keyBuffer[count] = K();     // Releases the resources of the vacated slot
+
+    return true;
+}
+
+/**
+ * @brief   Removes all keys and frees the buffer.
+ */
+template<class K, class Compare>
+void FlatSet<K, Compare>::EraseAll()
+{
+    delete keys;
+    keys    = nullptr;
+    count   = 0;
+}
+
+/**
+ * @brief   Grows the buffer so that the given number of keys fits without a reallocation.
+ * @param   capacity    Number of keys
+ */
+template<class K, class Compare>
+void FlatSet<K, Compare>::Reserve(const size_t capacity)
+{
+    if(capacity > GetCapacity())
+        Reallocate(capacity);
+}
+
+/**
+ * @brief   Shrinks the buffer to the number of keys.
+ */
+template<class K, class Compare>
+void FlatSet<K, Compare>::ShrinkToFit()
+{
+    if(count == 0)
+        EraseAll();
+    else if(count < GetCapacity())
+        Reallocate(count);
+    else;
+}
+
+/**
+ * @brief   Exchanges the content of two sets, no key is copied.
+ * @param   anotherSet  Set to be swapped with
+ */
+template<class K, class Compare>
+void FlatSet<K, Compare>::Swap(FlatSet& anotherSet)
+{
+    std::swap(keys,     anotherSet.keys);
+    std::swap(count,    anotherSet.count);
+    std::swap(compare,  anotherSet.compare);
+}
+
+/**
+ * @brief   Rank of the first key which is not less than the given one.
+ * @param   key Search key
+ * @return  Index into the buffer, count if all keys are less.
+ */
+template<class K, class Compare>
+size_t FlatSet<K, Compare>::LowerBound(const K& key) const
+{
+    return (count == 0) ? 0 : FlatLowerBound(keys->begin(), count, key, compare);
+}
+
+/**
+ * @brief   Moves the keys into a new buffer.
+ * @param   capacity    Number of keys of the new buffer, not less than the key count
+ */
+template<class K, class Compare>
+void FlatSet<K, Compare>::Reallocate(const size_t capacity)
+{
+    Array<K>* newKeys = new Array<K>(capacity);
+
+    for(size_t index = 0; index < count; index++)
+        newKeys->begin()[index] = std::move(keys->begin()[index]);
+
+    delete keys;
+    keys = newKeys;
+}
+
+#endif  // Prevent recursive inclusion
@@ -2,12 +2,15 @@
 // Author:      Caglayan DOKME
 // Date:        February 20, 2021 -> First release
 //              February 23, 2021 -> std::function example added.
+//              October 18, 2026  -> Parallel variant example added. (Link with -pthread)
 
 #include <iostream>
 #include <vector>
 #include <iterator>
 #include <functional>
 
+#include "ParallelFunction.h"
+
 using namespace std;
 
 template<typename ContainerType, typename LambdaType>
@@ -71,5 +74,13 @@ int main(int argc, char const *argv[]) {
     Function(v1, stdFuncLabmda);
     cout << endl;
 
+    /** Parallel Variant **/
+    // The lambda is called concurrently from several threads, so it must not modify shared state.
+    // See ParallelFunctionBenchmark.cpp for the scaling on large containers.
+    cout << "Printing values(>limit) collected by multiple threads in the original order : " << endl;
+    for(int value : ParallelFunction(v1, lambdaFuncCapture, FilterOrder::Preserve))
+        cout << value << endl;
+    cout << endl;
+
     return 0;
 }
@@ -0,0 +1,452 @@
+/** @file       InstrumentedStreamBuf.h
+ *  @details    Stream buffer that measures the I/O done through an ostream or istream.
+ *              It forwards to another stream buffer or to a file descriptor and counts the bytes,
+ *              the write and read calls, the flushes and the time spent blocked in the sink.
+ *              Any stream can be instrumented in place, so the stream operators of Array and List
+ *              and ostream_iterator based loggers are measured without any change.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Counters are atomic, a monitoring thread may take snapshots while the stream is in use.
+ *  @note       With a file descriptor sink every write call is a system call. With a stream buffer
+ *              sink a write call is a block handed over to that buffer.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef INSTRUMENTED_STREAM_BUF_H
+#define INSTRUMENTED_STREAM_BUF_H
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <streambuf>
+#include <string>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+#include <cerrno>
+#include <unistd.h>
+
+/**
+ * @brief   Snapshot of the counters of an InstrumentedStreamBuf.
+ */
+struct IoStatistics{
+    uint64_t bytesWritten       = 0;    // Bytes handed over to the sink
+    uint64_t writeCalls         = 0;    // Write calls made to the sink
+    uint64_t flushes            = 0;    // Explicit flushes, e.g. std::flush and std::endl
+    double writeBlockedSeconds  = 0;    // Time spent inside the write calls
+    uint64_t bytesRead          = 0;    // Bytes received from the source
+    uint64_t readCalls          = 0;    // Read calls made to the source
+    double readBlockedSeconds   = 0;    // Time spent inside the read calls
+    double elapsedSeconds       = 0;    // Time since the construction or the last reset
+
+    double GetWriteThroughput() const   // Bytes per second while blocked in the sink
+    { return (writeBlockedSeconds > 0) ? bytesWritten / writeBlockedSeconds : 0; }
+
+    double GetReadThroughput() const    // Bytes per second while blocked in the source
+    { return (readBlockedSeconds > 0) ? bytesRead / readBlockedSeconds : 0; }
+
+    std::string ToText() const;     // Single line of key=value pairs
+    std::string ToJson() const;     // Single JSON object
+};
+
+/**
+ * @brief   Formats the snapshot as a log friendly line.
+ * @return  Text of the form "bytes_written=... write_calls=... ...".
+ */
+inline std::string IoStatistics::ToText() const
+{
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(6)
+         << "bytes_written="        << bytesWritten
+         << " write_calls="         << writeCalls
+         << " flushes="             << flushes
+         << " write_blocked_s="     << writeBlockedSeconds
+         << " write_MBps="          << std::setprecision(1) << GetWriteThroughput() / 1e6 << std::setprecision(6)
+         << " bytes_read="          << bytesRead
+         << " read_calls="          << readCalls
+         << " read_blocked_s="      << readBlockedSeconds
+         << " read_MBps="           << std::setprecision(1) << GetReadThroughput() / 1e6 << std::setprecision(6)
+         << " elapsed_s="           << elapsedSeconds;
+
+    return text.str();
+}
+
+/**
+ * @brief   Formats the snapshot as JSON.
+ * @return  JSON object with one member per counter.
+ */
+inline std::string IoStatistics::ToJson() const
+{
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(6)
+         << "{\"bytesWritten\":"        << bytesWritten
+         << ",\"writeCalls\":"          << writeCalls
+         << ",\"flushes\":"             << flushes
+         << ",\"writeBlockedSeconds\":" << writeBlockedSeconds
+         << ",\"writeBytesPerSecond\":" << std::setprecision(0) << GetWriteThroughput() << std::setprecision(6)
+         << ",\"bytesRead\":"           << bytesRead
+         << ",\"readCalls\":"           << readCalls
+         << ",\"readBlockedSeconds\":"  << readBlockedSeconds
+         << ",\"readBytesPerSecond\":"  << std::setprecision(0) << GetReadThroughput() << std::setprecision(6)
+         << ",\"elapsedSeconds\":"      << elapsedSeconds << "}";
+
+    return json.str();
+}
+
+/**
+ * @brief   Counting stream buffer in front of another stream buffer or a file descriptor.
+ */
+class InstrumentedStreamBuf : public std::streambuf{
+public:
+    static constexpr size_t defaultCapacity = 64 * 1024;
+
+    InstrumentedStreamBuf(std::streambuf* target, const size_t capacity = defaultCapacity);    // Forwards to a stream buffer
+    InstrumentedStreamBuf(const int fileDescriptor, const size_t capacity = defaultCapacity);  // Forwards to a descriptor
+    InstrumentedStreamBuf(std::ios& stream, const size_t capacity = defaultCapacity);          // Instruments the stream in place
+
+    InstrumentedStreamBuf(const InstrumentedStreamBuf&) = delete;
+    InstrumentedStreamBuf& operator=(const InstrumentedStreamBuf&) = delete;
+
+    ~InstrumentedStreamBuf() override;  // Flushes, restores the buffer of an instrumented stream
+
+    IoStatistics GetStatistics() const; // Consistent enough for monitoring, counters are read one by one
+    void ResetStatistics();             // Zeroes the counters and restarts the elapsed time
+
+protected:
+    int_type overflow(int_type character) override;
+    std::streamsize xsputn(const char* data, std::streamsize length) override;
+    int sync() override;
+    int_type underflow() override;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    bool FlushPutArea();                                // Writes the buffered output out
+    bool WriteOut(const char* data, size_t length);     // Sends a block to the sink
+    size_t ReadIn(char* data, const size_t length);     // Receives at most length bytes, zero at the end
+
+    static uint64_t Now()
+    { return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count()); }
+
+    std::streambuf* target  = nullptr;  // Sink buffer, nullptr if a descriptor is used
+    int fileDescriptor      = -1;       // Sink descriptor, -1 if a stream buffer is used
+    std::ios* instrumented  = nullptr;  // Stream whose buffer is replaced, if any
+    size_t capacity         = 0;        // Size of each of the put and get areas
+    std::unique_ptr<char[]> putArea;    // Output buffer
+    std::unique_ptr<char[]> getArea;    // Input buffer, allocated on the first read
+
+    std::atomic<uint64_t> bytesWritten{0}, writeCalls{0}, flushes{0}, writeBlockedNs{0};
+    std::atomic<uint64_t> bytesRead{0}, readCalls{0}, readBlockedNs{0};
+    std::atomic<uint64_t> startNs{0};
+};
+
+/**
+ * @brief   Constructs a buffer forwarding to another stream buffer.
+ * @param   target      Sink and source buffer, must outlive this buffer.
+ * @param   capacity    Size of the internal buffers, zero disables the output buffering.
+ * @throws  std::logic_error When the target is NULL.
+ */
+inline InstrumentedStreamBuf::InstrumentedStreamBuf(std::streambuf* target, const size_t capacity)
+: target(target), capacity(capacity), startNs(Now())
+{
+    if(target == nullptr)
+        throw std::logic_error("Target stream buffer cannot be NULL!");
+
+    if(capacity != 0)
+    {
+        putArea.reset(new char[capacity]);
+        setp(putArea.get(), putArea.get() + capacity);
+    }
+}
+
+/**
+ * @brief   Constructs a buffer forwarding to a file descriptor.
+ * @param   fileDescriptor  Sink and source descriptor, it is not closed.
+ * @param   capacity        Size of the internal buffers, zero disables the output buffering.
+ * @throws  std::logic_error When the descriptor is invalid.
+ */
+inline InstrumentedStreamBuf::InstrumentedStreamBuf(const int fileDescriptor, const size_t capacity)
+: fileDescriptor(fileDescriptor), capacity(capacity), startNs(Now())
+{
+    if(fileDescriptor < 0)
+        throw std::logic_error("Invalid file descriptor!");
+
+    if(capacity != 0)
+    {
+        putArea.reset(new char[capacity]);
+        setp(putArea.get(), putArea.get() + capacity);
+    }
+}
+
+/**
+ * @brief   Instruments an existing stream by placing itself in front of its buffer.
+ * @param   stream      Stream to be instrumented, must outlive this buffer.
+ * @param   capacity    Size of the internal buffers, zero disables the output buffering.
+ * @note    The original buffer of the stream is restored by the destructor.
+ */
+inline InstrumentedStreamBuf::InstrumentedStreamBuf(std::ios& stream, const size_t capacity)
+: InstrumentedStreamBuf(stream.rdbuf(), capacity)
+{
+    instrumented = &stream;
+    stream.rdbuf(this);
+}
+
+/**
+ * @brief   Flushes the buffered output and detaches from the instrumented stream.
+ */
+inline InstrumentedStreamBuf::~InstrumentedStreamBuf()
+{
+    FlushPutArea();
+
+    if(instrumented != nullptr)
+    {
+        // Unread input cannot be returned to the original buffer, it is dropped
+        const std::ios::iostate state = instrumented->rdstate();
+        instrumented->rdbuf(target);
+        instrumented->clear(state);
+    }
+}
+
+/**
+ * @brief   Takes a snapshot of the counters.
+ * @return  Counter values and the elapsed time.
+ */
+inline IoStatistics InstrumentedStreamBuf::GetStatistics() const
+{
+    IoStatistics statistics;
+
+    statistics.bytesWritten         = bytesWritten.load(std::memory_order_relaxed);
+    statistics.writeCalls           = writeCalls.load(std::memory_order_relaxed);
+    statistics.flushes              = flushes.load(std::memory_order_relaxed);
+    statistics.writeBlockedSeconds  = writeBlockedNs.load(std::memory_order_relaxed) / 1e9;
+    statistics.bytesRead            = bytesRead.load(std::memory_order_relaxed);
+    statistics.readCalls            = readCalls.load(std::memory_order_relaxed);
+    statistics.readBlockedSeconds   = readBlockedNs.load(std::memory_order_relaxed) / 1e9;
+    statistics.elapsedSeconds       = (Now() - startNs.load(std::memory_order_relaxed)) / 1e9;
+
+    return statistics;
+}
+
+/**
+ * @brief   Zeroes all counters.
+ */
+inline void InstrumentedStreamBuf::ResetStatistics()
+{
+    for(std::atomic<uint64_t>* counter : {&bytesWritten, &writeCalls, &flushes, &writeBlockedNs, &bytesRead, &readCalls, &readBlockedNs})
+        counter->store(0, std::memory_order_relaxed);
+
+    startNs.store(Now(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Called by the stream when the put area is full.
+ * @param   character   Character to be written, or eof to flush.
+ * @return  Anything but eof on success.
+ */
+inline InstrumentedStreamBuf::int_type InstrumentedStreamBuf::overflow(int_type character)
+{
+    if(FlushPutArea() == false)
+        return traits_type::eof();
+
+    if(traits_type::eq_int_type(character, traits_type::eof()) == true)
+        return traits_type::not_eof(character);
+
+    const char value = traits_type::to_char_type(character);
+
+    if(capacity == 0)   // Unbuffered, each character is a write call
+        return (WriteOut(&value, 1) == true) ? character : traits_type::eof();
+
+    *pptr() = value;
+    pbump(1);
+
+    return character;
+}
+
+/**
+ * @brief   Writes a block, large blocks bypass the put area.
+ * @param   data    Source characters.
+ * @param   length  Number of characters.
+ * @return  Number of characters accepted.
+ */
+inline std::streamsize InstrumentedStreamBuf::xsputn(const char* data, std::streamsize length)
+{
+    if(length <= 0)
+        return 0;
+
+    const size_t size = static_cast<size_t>(length);
+
+    if(size <= static_cast<size_t>(epptr() - pptr()))
+    {
+        std::memcpy(pptr(), data, size);
+        pbump(static_cast<int>(size));
+        return length;
+    }
+
+    if(FlushPutArea() == false)
+        return 0;
+
+    if(size >= capacity)
+        return (WriteOut(data, size) == true) ? length : 0;
+
+    std::memcpy(pptr(), data, size);
+    pbump(static_cast<int>(size));
+
+    return length;
+}
+
+/**
+ * @brief   Flushes the buffered output and the sink buffer.
+ * @return  Zero on success, -1 on failure.
+ */
+inline int InstrumentedStreamBuf::sync()
+{
+    flushes.fetch_add(1, std::memory_order_relaxed);
+
+    if(FlushPutArea() == false)
+        return -1;
+
+    if(target != nullptr)
+        return target->pubsync();
+
+    return 0;
+}
+
+/**
+ * @brief   Called by the stream when the get area is exhausted.
+ * @return  The next character, or eof at the end of the input.
+ */
+inline InstrumentedStreamBuf::int_type InstrumentedStreamBuf::underflow()
+{
+    if(gptr() < egptr())
+        return traits_type::to_int_type(*gptr());
+
+    const size_t areaSize = std::max<size_t>(capacity, 1);
+
+    if(getArea == nullptr)
+        getArea.reset(new char[areaSize]);
+
+    const size_t received = ReadIn(getArea.get(), areaSize);
+    if(received == 0)
+        return traits_type::eof();
+
+    setg(getArea.get(), getArea.get(), getArea.get() + received);
+
+    return traits_type::to_int_type(*gptr());
+}
+
+/**
+ * @brief   Writes the content of the put area to the sink.
+ * @return  True on success.
+ */
+inline bool InstrumentedStreamBuf::FlushPutArea()
+{
+    const size_t used = static_cast<size_t>(pptr() - pbase());
+    if(used == 0)
+        return true;
+
+    const bool success = WriteOut(pbase(), used);
+    setp(putArea.get(), putArea.get() + capacity);  // Content is dropped on failure, as the stream goes bad anyway
+
+    return success;
+}
+
+/**
+ * @brief   Sends a block to the sink, measuring the time spent.
+ * @param   data    Source characters.
+ * @param   length  Number of characters.
+ * @return  True if all characters are written.
+ */
+inline bool InstrumentedStreamBuf::WriteOut(const char* data, size_t length)
+{
+    const uint64_t start = Now();
+    bool success = true;
+
+    if(target != nullptr)
+    {
+        writeCalls.fetch_add(1, std::memory_order_relaxed);
+        const std::streamsize written = target->sputn(data, static_cast<std::streamsize>(length));
+
+        bytesWritten.fetch_add(static_cast<uint64_t>(std::max<std::streamsize>(written, 0)), std::memory_order_relaxed);
+        success = (written == static_cast<std::streamsize>(length));
+    }
+    else
+    {
+        // Partial writes of pipes and sockets are resumed
+        while(length > 0)
+        {
+            writeCalls.fetch_add(1, std::memory_order_relaxed);
+            const ssize_t written = ::write(fileDescriptor, data, length);
+
+            if(written < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+
+                success = false;
+                break;
+            }
+
+            bytesWritten.fetch_add(static_cast<uint64_t>(written), std::memory_order_relaxed);
+            data    += written;
+            length  -= static_cast<size_t>(written);
+        }
+    }
+
+    writeBlockedNs.fetch_add(Now() - start, std::memory_order_relaxed);
+
+    return success;
+}
+
+/**
+ * @brief   Receives a block from the source, measuring the time spent.
+ * @param   data    Destination buffer.
+ * @param   length  Size of the destination buffer.
+ * @return  Number of bytes received, zero at the end of the input or on failure.
+ */
+inline size_t InstrumentedStreamBuf::ReadIn(char* data, const size_t length)
+{
+    const uint64_t start = Now();
+    size_t received = 0;
+
+    if(target != nullptr)
+    {
+        // sgetn waits until the whole request is satisfied, so only what is known to be available is requested
+        const std::streamsize available = target->in_avail();
+
+        if(available >= 0)
+        {
+            const std::streamsize request = std::min<std::streamsize>(std::max<std::streamsize>(available, 1),
+                                                                      static_cast<std::streamsize>(length));
+
+            readCalls.fetch_add(1, std::memory_order_relaxed);
+            received = static_cast<size_t>(std::max<std::streamsize>(target->sgetn(data, request), 0));
+        }
+        else;   // Source reports the end of the input
+    }
+    else
+    {
+        ssize_t result;
+
+        do
+        {
+            readCalls.fetch_add(1, std::memory_order_relaxed);
+            result = ::read(fileDescriptor, data, length);
+        } while((result < 0) && (errno == EINTR));
+
+        received = (result > 0) ? static_cast<size_t>(result) : 0;
+    }
+
+    bytesRead.fetch_add(received, std::memory_order_relaxed);
+    readBlockedNs.fetch_add(Now() - start, std::memory_order_relaxed);
+
+    return received;
+}
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,116 @@
+// Description: Cost and output of InstrumentedStreamBuf on the stream operators of Array and List
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 InstrumentedStreamBufBenchmark.cpp -o InstrumentedStreamBufBenchmark
+// Usage:       ./InstrumentedStreamBufBenchmark [elementCount] [outputPath]
+//              (defaults: 5000000 and /dev/null)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <string>
+#include <numeric>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Benchmark.h"
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "InstrumentedStreamBuf.h"
+
+using namespace std;
+
+// Prints a result row with the overhead against the reference
+static void Report(const string& name, const double seconds, const double reference)
+{
+    cout << setw(44) << left << name << right
+         << setw(10) << fixed << setprecision(4) << seconds << " s"
+         << setw(9) << setprecision(1) << 100.0 * (seconds - reference) / reference << " %" << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t elementCount   = (argc > 1) ? stoull(argv[1]) : 5000000;
+    const char* path            = (argc > 2) ? argv[2] : "/dev/null";
+    const size_t repetitions    = 3;
+
+    Array<int> array(elementCount);
+    iota(array.begin(), array.end(), 0);
+    List<int> list(array.begin(), array.end());
+
+    // Reference: plain file streams
+    const double arrayReference = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        file << array;
+    });
+    Report("Array operator<< -> ofstream", arrayReference, arrayReference);
+
+    const double arrayInstrumented = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        InstrumentedStreamBuf probe(file);
+        file << array;
+    });
+    Report("Array operator<< -> instrumented ofstream", arrayInstrumented, arrayReference);
+
+    const double listReference = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        file << list;
+    });
+    Report("List operator<< -> ofstream", listReference, listReference);
+
+    const double listInstrumented = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        InstrumentedStreamBuf probe(file);
+        file << list;
+    });
+    Report("List operator<< -> instrumented ofstream", listInstrumented, listReference);
+
+    // Snapshots of a single run against the file descriptor, one write call is one system call
+    for(const size_t capacity : {4096ul, 65536ul, 1048576ul})
+    {
+        const int fileDescriptor = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if(fileDescriptor < 0)
+        {
+            cerr << "Cannot open " << path << endl;
+            return 1;
+        }
+
+        {
+            InstrumentedStreamBuf probe(fileDescriptor, capacity);
+            ostream stream(&probe);
+
+            copy(array.begin(), array.end(), ostream_iterator<int>(stream, "\n"));
+            stream.flush();
+
+            cout << "Buffer " << setw(8) << capacity << ": " << probe.GetStatistics().ToText() << endl;
+            if(capacity == 65536)
+                cout << "JSON: " << probe.GetStatistics().ToJson() << endl;
+        }
+
+        close(fileDescriptor);
+    }
+
+    // Reading back through an instrumented istream
+    {
+        ostringstream text;
+        text << array;
+
+        istringstream source(text.str());
+        InstrumentedStreamBuf probe(source);
+
+        Array<int> loaded(elementCount);
+        source >> loaded;
+
+        cout << "Input:  " << probe.GetStatistics().ToText() << endl;
+    }
+
+    return 0;
+}
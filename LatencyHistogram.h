@@ -0,0 +1,487 @@
+/** @file       LatencyHistogram.h
+ *  @details    Log-linear latency histogram in the spirit of HdrHistogram.
+ *              Each power of two range is split into equal sub-buckets, so every recorded value is
+ *              kept with a bounded relative error (below 1/32 with the default precision) from
+ *              nanoseconds up to the full 64-bit range in a fixed table of counters.
+ *              LatencyRecorder gives every recording thread its own histogram and merges them on
+ *              demand without stopping the writers, which suits per-operation timings of containers.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Percentiles are reported as the highest value of their bucket, clamped to the exact maximum.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief   Summary of a latency distribution, in nanoseconds.
+ */
+struct LatencySummary{
+    uint64_t count  = 0;
+    uint64_t min    = 0;
+    double mean     = 0;
+    uint64_t p50    = 0;
+    uint64_t p90    = 0;
+    uint64_t p99    = 0;
+    uint64_t p999   = 0;
+    uint64_t max    = 0;
+
+    std::string ToText() const;     // Single line of key=value pairs
+    std::string ToJson() const;     // Single JSON object
+};
+
+/**
+ * @brief   Formats the summary as a log friendly line.
+ * @return  Text of the form "count=... p50_ns=... ...".
+ */
+inline std::string LatencySummary::ToText() const
+{
+    std::ostringstream text;
+    text << "count="        << count
+         << " min_ns="      << min
+         << " mean_ns="     << std::fixed << std::setprecision(1) << mean
+         << " p50_ns="      << p50
+         << " p90_ns="      << p90
+         << " p99_ns="      << p99
+         << " p999_ns="     << p999
+         << " max_ns="      << max;
+
+    return text.str();
+}
+
+/**
+ * @brief   Formats the summary as JSON.
+ * @return  JSON object with one member per field.
+ */
+inline std::string LatencySummary::ToJson() const
+{
+    std::ostringstream json;
+    json << "{\"count\":"   << count
+         << ",\"minNs\":"   << min
+         << ",\"meanNs\":"  << std::fixed << std::setprecision(1) << mean
+         << ",\"p50Ns\":"   << p50
+         << ",\"p90Ns\":"   << p90
+         << ",\"p99Ns\":"   << p99
+         << ",\"p999Ns\":"  << p999
+         << ",\"maxNs\":"   << max << "}";
+
+    return json.str();
+}
+
+/**
+ * @brief   Fixed size log-linear histogram of 64-bit values.
+ * @note    Record() may be called from any thread. Single writer histograms can use
+ *          RecordSingleWriter(), which avoids the locked instructions.
+ */
+class LatencyHistogram{
+public:
+    static constexpr unsigned subBucketBits     = 6;                            // Precision of each power of two range
+    static constexpr size_t subBucketCount      = size_t(1) << subBucketBits;   // Values below are counted exactly
+    static constexpr size_t halfCount           = subBucketCount / 2;
+    static constexpr size_t bucketCount         = (66 - subBucketBits) * halfCount;
+
+    LatencyHistogram() = default;
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void Record(const uint64_t value);              // Thread safe
+    void RecordSingleWriter(const uint64_t value);  // Only one thread may record, readers may run concurrently
+    void Add(const LatencyHistogram& another);      // Adds the counts of another histogram
+    void Reset();                                   // Zeroes the counts, racing records may survive
+
+    uint64_t GetCount() const   { return total.load(std::memory_order_relaxed); }
+    LatencySummary GetSummary() const;
+    uint64_t GetPercentile(const double percentile) const;  // Percentile in [0, 100]
+
+    static size_t BucketIndex(const uint64_t value);
+    static uint64_t BucketHighestValue(const size_t index);
+
+private:
+    std::atomic<uint64_t> counts[bucketCount] = {};
+    std::atomic<uint64_t> total{0};
+    std::atomic<uint64_t> sum{0};
+    std::atomic<uint64_t> minimum{UINT64_MAX};
+    std::atomic<uint64_t> maximum{0};
+};
+
+/**
+ * @brief   Maps a value to its bucket.
+ * @param   value   Recorded value.
+ * @return  Index of the bucket, values below subBucketCount have their own buckets.
+ */
+inline size_t LatencyHistogram::BucketIndex(const uint64_t value)
+{
+    if(value < subBucketCount)
+        return static_cast<size_t>(value);
+
+    // The top subBucketBits bits of the value select the sub-bucket of its power of two range
+    const unsigned shift = static_cast<unsigned>(63 - __builtin_clzll(value)) - (subBucketBits - 1);
+    return shift * halfCount + static_cast<size_t>(value >> shift);
+}
+
+/**
+ * @brief   Computes the highest value counted in a bucket.
+ * @param   index   Bucket index.
+ * @return  Highest value mapped to the bucket.
+ */
+inline uint64_t LatencyHistogram::BucketHighestValue(const size_t index)
+{
+    if(index < subBucketCount)
+        return index;
+
+    const size_t shift      = index / halfCount - 1;
+    const uint64_t mantissa = index - shift * halfCount;
+
+    return ((mantissa + 1) << shift) - 1;   // Wraps to the maximum for the last bucket
+}
+
+/**
+ * @brief   Adds a value, safe to call from multiple threads.
+ * @param   value   Value to be recorded, e.g. nanoseconds.
+ */
+inline void LatencyHistogram::Record(const uint64_t value)
+{
+    counts[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t current = minimum.load(std::memory_order_relaxed);
+    while((value < current) && (minimum.compare_exchange_weak(current, value, std::memory_order_relaxed) == false))
+    { /* current is reloaded by the failed exchange */ }
+
+    current = maximum.load(std::memory_order_relaxed);
+    while((value > current) && (maximum.compare_exchange_weak(current, value, std::memory_order_relaxed) == false))
+    { /* current is reloaded by the failed exchange */ }
+}
+
+/**
+ * @brief   Adds a value with plain loads and stores, for histograms owned by a single thread.
+ * @param   value   Value to be recorded, e.g. nanoseconds.
+ */
+inline void LatencyHistogram::RecordSingleWriter(const uint64_t value)
+{
+    std::atomic<uint64_t>& bucket = counts[BucketIndex(value)];
+
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    total.store(total.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+
+    if(value < minimum.load(std::memory_order_relaxed))
+        minimum.store(value, std::memory_order_relaxed);
+
+    if(value > maximum.load(std::memory_order_relaxed))
+        maximum.store(value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Adds the counts of another histogram, the other one may be recording meanwhile.
+ * @param   another Source histogram.
+ */
+inline void LatencyHistogram::Add(const LatencyHistogram& another)
+{
+    uint64_t added = 0;
+
+    for(size_t index = 0; index < bucketCount; index++)
+    {
+        const uint64_t count = another.counts[index].load(std::memory_order_relaxed);
+        if(count != 0)
+        {
+            counts[index].fetch_add(count, std::memory_order_relaxed);
+            added += count;
+        }
+    }
+
+    // The total follows the buckets actually read, so percentiles stay consistent
+    total.fetch_add(added, std::memory_order_relaxed);
+    sum.fetch_add(another.sum.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    const uint64_t anotherMinimum = another.minimum.load(std::memory_order_relaxed);
+    uint64_t current = minimum.load(std::memory_order_relaxed);
+    while((anotherMinimum < current) && (minimum.compare_exchange_weak(current, anotherMinimum, std::memory_order_relaxed) == false))
+    { /* current is reloaded by the failed exchange */ }
+
+    const uint64_t anotherMaximum = another.maximum.load(std::memory_order_relaxed);
+    current = maximum.load(std::memory_order_relaxed);
+    while((anotherMaximum > current) && (maximum.compare_exchange_weak(current, anotherMaximum, std::memory_order_relaxed) == false))
+    { /* current is reloaded by the failed exchange */ }
+}
+
+/**
+ * @brief   Zeroes all counts.
+ */
+inline void LatencyHistogram::Reset()
+{
+    for(std::atomic<uint64_t>& count : counts)
+        count.store(0, std::memory_order_relaxed);
+
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    minimum.store(UINT64_MAX, std::memory_order_relaxed);
+    maximum.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Finds the value below which the given percentage of the records fall.
+ * @param   percentile  Percentage in [0, 100].
+ * @return  Highest value of the bucket holding the percentile, clamped to the maximum. Zero if empty.
+ */
+inline uint64_t LatencyHistogram::GetPercentile(const double percentile) const
+{
+    const uint64_t count = total.load(std::memory_order_relaxed);
+    if(count == 0)
+        return 0;
+
+    const double clamped    = std::min(100.0, std::max(0.0, percentile));
+    const uint64_t rank     = std::max<uint64_t>(1, static_cast<uint64_t>(clamped / 100.0 * count + 0.5));
+    const uint64_t highest  = maximum.load(std::memory_order_relaxed);
+    uint64_t cumulative     = 0;
+
+    for(size_t index = 0; index < bucketCount; index++)
+    {
+        cumulative += counts[index].load(std::memory_order_relaxed);
+        if(cumulative >= rank)
+            return std::min(BucketHighestValue(index), highest);
+    }
+
+    return highest;
+}
+
+/**
+ * @brief   Computes the summary of the distribution.
+ * @return  Count, extremes, mean and the percentiles.
+ */
+inline LatencySummary LatencyHistogram::GetSummary() const
+{
+    LatencySummary summary;
+
+    summary.count = total.load(std::memory_order_relaxed);
+    if(summary.count == 0)
+        return summary;
+
+    summary.min     = minimum.load(std::memory_order_relaxed);
+    summary.max     = maximum.load(std::memory_order_relaxed);
+    summary.mean    = static_cast<double>(sum.load(std::memory_order_relaxed)) / summary.count;
+    summary.p50     = GetPercentile(50);
+    summary.p90     = GetPercentile(90);
+    summary.p99     = GetPercentile(99);
+    summary.p999    = GetPercentile(99.9);
+
+    return summary;
+}
+
+/**
+ * @brief   Latency recorder with one histogram per recording thread.
+ * @note    Recording touches only the histogram of the calling thread. Summaries merge all of
+ *          them with relaxed loads, so the writers are never stopped or locked.
+ */
+class LatencyRecorder{
+public:
+    LatencyRecorder() : id(NextId())
+    { /* Empty constructor */ }
+
+    LatencyRecorder(const LatencyRecorder&) = delete;
+    LatencyRecorder& operator=(const LatencyRecorder&) = delete;
+
+    void Record(const uint64_t nanoseconds)     // Adds a sample to the histogram of the calling thread
+    { ThreadHistogram().RecordSingleWriter(nanoseconds); }
+
+    LatencySummary GetSummary() const   { return Merge()->GetSummary(); }
+    std::unique_ptr<LatencyHistogram> Merge() const;    // Sum of the histograms of all threads
+    void Reset();                                       // Zeroes all histograms, racing records may survive
+
+private:
+    static uint64_t NextId()
+    {
+        static std::atomic<uint64_t> counter{0};
+        return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    LatencyHistogram& ThreadHistogram();
+
+    const uint64_t id;  // Never reused, so stale thread caches cannot match a new recorder
+    mutable std::mutex lock;
+    std::vector<std::unique_ptr<LatencyHistogram>> histograms;
+};
+
+/**
+ * @brief   Finds or creates the histogram of the calling thread.
+ * @return  Histogram written only by the calling thread.
+ */
+inline LatencyHistogram& LatencyRecorder::ThreadHistogram()
+{
+    struct CacheEntry{
+        uint64_t recorder;
+        LatencyHistogram* histogram;
+    };
+
+    thread_local std::vector<CacheEntry> cache;
+    thread_local CacheEntry last{0, nullptr};
+
+    if(last.recorder == id)     // Fast path, a thread usually records into the same recorder
+        return *last.histogram;
+
+    for(const CacheEntry& entry : cache)
+    {
+        if(entry.recorder == id)
+        {
+            last = entry;
+            return *entry.histogram;
+        }
+    }
+
+    LatencyHistogram* histogram = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        histograms.push_back(std::unique_ptr<LatencyHistogram>(new LatencyHistogram()));
+        histogram = histograms.back().get();
+    }
+
+    last = CacheEntry{id, histogram};
+    cache.push_back(last);
+
+    return *histogram;
+}
+
+/**
+ * @brief   Sums the histograms of all threads.
+ * @return  Merged histogram, independent of the recorder.
+ */
+inline std::unique_ptr<LatencyHistogram> LatencyRecorder::Merge() const
+{
+    std::unique_ptr<LatencyHistogram> merged(new LatencyHistogram());
+    std::lock_guard<std::mutex> guard(lock);   // Guards the vector only, the writers do not take it
+
+    for(const std::unique_ptr<LatencyHistogram>& histogram : histograms)
+        merged->Add(*histogram);
+
+    return merged;
+}
+
+/**
+ * @brief   Zeroes the histograms of all threads.
+ */
+inline void LatencyRecorder::Reset()
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    for(std::unique_ptr<LatencyHistogram>& histogram : histograms)
+        histogram->Reset();
+}
+
+/**
+ * @brief   Records the lifetime of the object into a recorder.
+ */
+class ScopedLatency{
+public:
+    explicit ScopedLatency(LatencyRecorder& recorder)
+    : recorder(recorder), start(std::chrono::steady_clock::now())
+    { /* Empty constructor */ }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+    ~ScopedLatency()
+    {
+        recorder.Record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start).count()));
+    }
+
+private:
+    LatencyRecorder& recorder;
+    const std::chrono::steady_clock::time_point start;
+};
+
+/**
+ * @brief   Runs the callable and records its duration.
+ * @param   recorder    Destination recorder.
+ * @param   callable    Work to be timed, e.g. [&]() { list.RemoveFirstOf(key); }
+ * @return  Whatever the callable returns.
+ */
+template<class CallableType>
+auto Timed(LatencyRecorder& recorder, CallableType&& callable) -> decltype(callable())
+{
+    ScopedLatency timer(recorder);
+    return callable();
+}
+
+/**
+ * @brief   Set of recorders keyed by operation name, e.g. "List::Resize".
+ * @note    Look the recorder up once and keep the reference on hot paths.
+ */
+class OperationLatencies{
+public:
+    LatencyRecorder& operator[](const std::string& operation);  // Creates the recorder on the first use
+
+    void Report(std::ostream& stream) const;    // One line per operation
+    std::string ToJson() const;                 // Object with one member per operation
+
+private:
+    mutable std::mutex lock;
+    std::map<std::string, std::unique_ptr<LatencyRecorder>> recorders;
+};
+
+/**
+ * @brief   Finds or creates the recorder of an operation.
+ * @param   operation   Operation name.
+ * @return  Recorder, valid as long as this object lives.
+ */
+inline LatencyRecorder& OperationLatencies::operator[](const std::string& operation)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    std::unique_ptr<LatencyRecorder>& recorder = recorders[operation];
+    if(recorder == nullptr)
+        recorder.reset(new LatencyRecorder());
+
+    return *recorder;
+}
+
+/**
+ * @brief   Writes the summary of each operation.
+ * @param   stream  Destination stream.
+ */
+inline void OperationLatencies::Report(std::ostream& stream) const
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    for(const auto& entry : recorders)
+        stream << std::left << std::setw(24) << entry.first << std::right << " " << entry.second->GetSummary().ToText() << '\n';
+}
+
+/**
+ * @brief   Formats the summaries of all operations as JSON.
+ * @return  JSON object keyed by the operation names.
+ */
+inline std::string OperationLatencies::ToJson() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    std::ostringstream json;
+
+    json << "{";
+    for(auto entry = recorders.begin(); entry != recorders.end(); ++entry)
+        json << ((entry == recorders.begin()) ? "" : ",") << "\"" << entry->first << "\":" << entry->second->GetSummary().ToJson();
+    json << "}";
+
+    return json.str();
+}
+
+#endif  // Prevent recursive inclusion
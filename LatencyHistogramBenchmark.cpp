@@ -0,0 +1,90 @@
+// Description: Per-operation latency percentiles of List and Array methods, recorded by several threads
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread LatencyHistogramBenchmark.cpp -o LatencyHistogramBenchmark
+// Usage:       ./LatencyHistogramBenchmark [elements] [operations per thread] [threads]
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <random>
+#include <cstdlib>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "LatencyHistogram.h"
+
+using namespace std;
+
+// Each thread works on its own containers and records into the shared recorders
+static void Worker(OperationLatencies& latencies, const size_t elements, const size_t operations, const unsigned seed)
+{
+    // References are looked up once, the hot loop touches only the thread local histograms
+    LatencyRecorder& removeFirstOf  = latencies["List::RemoveFirstOf"];
+    LatencyRecorder& resize         = latencies["List::Resize"];
+    LatencyRecorder& append         = latencies["List::Append"];
+    LatencyRecorder& arrayCopy      = latencies["Array::operator="];
+    LatencyRecorder& arrayAccess    = latencies["Array::operator[]"];
+
+    mt19937 generator(seed);
+    uniform_int_distribution<int> key(0, static_cast<int>(elements) - 1);
+
+    List<int> list;
+    for(size_t index = 0; index < elements; index++)
+        list.Append(key(generator));
+
+    Array<int> source(elements), destination(elements);
+    long checksum = 0;
+
+    for(size_t operation = 0; operation < operations; operation++)
+    {
+        Timed(removeFirstOf, [&]() { list.RemoveFirstOf(key(generator)); });
+        Timed(append, [&]() { list.Append(key(generator)); });
+
+        if(operation % 64 == 0)     // Rare but long, the stalls show up in the tail only
+        {
+            Timed(resize, [&]() { list.Resize(elements / 2); });
+            Timed(resize, [&]() { list.Resize(elements, key(generator)); });
+            Timed(arrayCopy, [&]() { destination = source; });
+        }
+
+        checksum += Timed(arrayAccess, [&]() { return destination[static_cast<size_t>(key(generator))]; });
+    }
+
+    if(checksum == -1)  // Keeps the reads alive
+        cout << checksum << endl;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t elements   = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000;
+    const size_t operations = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 2000;
+    const size_t threads    = (argc > 3) ? strtoul(argv[3], nullptr, 10) : 4;
+
+    if((elements == 0) || (threads == 0))
+    {
+        cerr << "Usage: " << argv[0] << " [elements] [operations per thread] [threads]" << endl;
+        return 1;
+    }
+
+    OperationLatencies latencies;
+    vector<thread> workers;
+
+    for(size_t index = 0; index < threads; index++)
+        workers.emplace_back(Worker, ref(latencies), elements, operations, static_cast<unsigned>(index + 1));
+
+    // Summaries can be taken while the threads are still recording
+    this_thread::sleep_for(chrono::milliseconds(10));
+    cout << "In flight: " << latencies["List::RemoveFirstOf"].GetSummary().ToText() << endl << endl;
+
+    for(thread& worker : workers)
+        worker.join();
+
+    cout << elements << " elements, " << operations << " operations, " << threads << " threads" << endl;
+    latencies.Report(cout);
+    cout << endl << latencies.ToJson() << endl;
+
+    return 0;
+}
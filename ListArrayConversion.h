@@ -0,0 +1,63 @@
+/** @file       ListArrayConversion.h
+ *  @details    Single pass conversions between List and Array which move the elements instead of copying them.
+ *              ToArray() moves the elements of a list into one contiguous block and frees every node right after
+ *              its element left, FromArray() moves the elements of an array into a new chain of nodes.
+ *              Neither goes through the bounds checked subscript operator or the list iterator.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       With CONTAINER_NODE_POOL, FromArray() builds the chain from whole runs of pool blocks,
+ *              so the nodes are laid out in list order. ToArray() hands each slot back to the pool of the list.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef LIST_ARRAY_CONVERSION_H
+#define LIST_ARRAY_CONVERSION_H
+
+#include <utility>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+
+/**
+ * @brief   Moves all elements of a list into a new array, in the same order.
+ * @param   list    Source list, empty afterwards.
+ * @return  Array of list.GetNodeCount() elements.
+ * @throws  std::logic_error If the list is empty, as an array cannot be of size zero.
+ * @note    The array is allocated once and each node is freed right after its element is moved, so the
+ *          nodes are visited only once. The element type must be default constructible, like for any array.
+ *          Usage: Array<int> numbers = ToArray(std::move(numberList));
+ */
+template<class T>
+Array<T> ToArray(List<T>&& list)
+{
+    Array<T> array(list.GetNodeCount());    // Throws for an empty list
+
+    list.MoveElementsTo(array.container);
+
+    return array;
+}
+
+/**
+ * @brief   Moves all elements of an array into a new list, in the same order.
+ * @param   array   Source array, released afterwards, so getSize() returns zero like after a move.
+ * @return  List of array.getSize() nodes.
+ * @note    With CONTAINER_NODE_POOL the nodes are carved from the pool in runs of consecutive slots,
+ *          otherwise each node is allocated on its own.
+ *          Usage: List<int> numberList = FromArray(std::move(numbers));
+ */
+template<class T>
+List<T> FromArray(Array<T>&& array)
+{
+    List<T> list;
+
+    list.AppendMoved(array.container, array.getSize());
+
+    array.ReleaseElements();
+    array.container = nullptr;  // Moved-from state, as left by the move constructor of Array
+
+    return list;
+}
+
+#endif  // Prevent recursive inclusion
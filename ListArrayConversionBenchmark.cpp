@@ -0,0 +1,110 @@
+// Description: List to Array conversions and back, element-wise copies against the single pass bulk moves
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 ListArrayConversionBenchmark.cpp -o ListArrayConversionBenchmark
+//              (add -DCONTAINER_NODE_POOL to build the node chains from pool blocks)
+// Usage:       ./ListArrayConversionBenchmark [elements]
+//              (default: 10000000, the string runs use a tenth of it)
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <optional>
+#include <utility>
+#include <cstdio>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "ListArrayConversion.h"
+
+using namespace std;
+
+static const size_t repetitions = 3;
+
+template<class T> T MakeValue(const size_t index);
+template<> int MakeValue<int>(const size_t index) { return static_cast<int>(index); }
+template<> string MakeValue<string>(const size_t index)
+{
+    char text[32];
+    snprintf(text, sizeof(text), "item%010zu", index);  // Long enough to defeat the small string optimization
+    return text;
+}
+
+static void PrintRow(const char* direction, const char* method, const char* type, const size_t count, const double seconds)
+{
+    cout << setw(16) << left << direction << setw(20) << method << setw(8) << type << right
+         << setw(12) << count << setw(12) << fixed << setprecision(2) << seconds * 1e3 << " ms"
+         << setw(10) << seconds * 1e9 / count << " ns/elem" << endl;
+}
+
+// Each conversion consumes its source, the source is rebuilt and the previous result is released out of the timed region
+template<class T>
+static void RunSuite(const char* type, const size_t count)
+{
+    optional<List<T>> list;
+    optional<Array<T>> array;
+
+    auto fillList = [&]()
+    {
+        array.reset();
+        list.emplace();
+        for(size_t index = 0; index < count; index++)
+            list->Append(MakeValue<T>(index));
+    };
+
+    auto fillArray = [&]()
+    {
+        list.reset();
+        array.emplace(count);
+        for(size_t index = 0; index < count; index++)
+            (*array)[index] = MakeValue<T>(index);
+    };
+
+    // Today: an element-wise copy through the iterator and the bounds checked subscript, then the list is dropped
+    PrintRow("List -> Array", "element-wise copy", type, count, Benchmark::MeasureBest(repetitions, fillList, [&]()
+    {
+        Array<T> converted(list->GetNodeCount());
+        auto it = list->begin();
+
+        for(size_t index = 0; index < converted.getSize(); index++, it++)
+            converted[index] = *it;
+
+        list->EraseAll();
+        array.emplace(move(converted));
+    }));
+
+    PrintRow("List -> Array", "ToArray", type, count, Benchmark::MeasureBest(repetitions, fillList, [&]()
+    {
+        array.emplace(ToArray(move(*list)));
+    }));
+
+    // Today: the range constructor copies each element into a separately allocated node
+    PrintRow("Array -> List", "range constructor", type, count, Benchmark::MeasureBest(repetitions, fillArray, [&]()
+    {
+        List<T> converted(array->begin(), array->end());
+
+        array.reset();
+        list.emplace(move(converted));
+    }));
+
+    PrintRow("Array -> List", "FromArray", type, count, Benchmark::MeasureBest(repetitions, fillArray, [&]()
+    {
+        list.emplace(FromArray(move(*array)));
+        array.reset();
+    }));
+}
+
+int main(int argc, char** argv)
+{
+    const size_t elements = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000000;
+
+#if defined(CONTAINER_NODE_POOL)
+    cout << "Node pool enabled" << endl;
+#endif
+
+    RunSuite<int>("int", elements);
+    RunSuite<string>("string", (elements / 10 > 0) ? elements / 10 : 1);
+
+    return 0;
+}
@@ -21,6 +21,23 @@
  *                                   Move constructor added.
  *                                   Initializer list constructor added.
  *                                   Equality and inequality operator overloaded for iterator class.
+ *              October 18, 2026  -> Concatenating into an empty list fixed.
+ *                                   Range constructor made half-open, as documented.
+ *                                   Ranges of List iterators kept inclusive, as List::end() is the last node.
+ *                                   RemoveFirst and RemoveLast reset both ends when the list becomes empty.
+ *                                   Range constructor releases the nodes if the source throws.
+ *                                   Missing return statement of EraseAll added.
+ *                                   Sort check made iterative, long lists overflowed the stack.
+ *                                   Merging an empty list fixed.
+ *                                   Node allocations routed through CreateNode and DestroyNode.
+ *                                   Opt-in allocation tracking added. (CONTAINER_ALLOCATION_TRACKING)
+ *                                   Tracing probes added to Find, RemoveIf, Sort and Merge. (CONTAINER_TRACING)
+ *                                   Opt-in deferred destruction of large lists added. (CONTAINER_DEFERRED_RECLAMATION)
+ *                                   Node constructor forwards its arguments.
+ *                                   Opt-in node pool and ShrinkToFit added. (CONTAINER_NODE_POOL)
+ *                                   Bulk conversion to and from Array added. (see ListArrayConversion.h)
+ *                                   Linear set operations of sorted lists added.
+ *                                   PartialSort, NthElement and TopK added, selecting with a bounded heap.
  *
  *  @note       Feel free to contact for questions, bugs or any other thing.
  *  @copyright  No copyright. Code is open source.
@@ -30,9 +47,36 @@
 #define LIST_CONTAINER_H
 
 #include <iostream>
-
-// Forward declaration
+#include <string>
+#include <stdexcept>
+#include <utility>
+#include <new>
+#include <type_traits>
+#include <functional>
+#include <vector>
+#include <algorithm>
+
+#include "AllocationTracker.h"
+#include "ContainerTrace.h"
+#include "DeferredReclaimer.h"
+#include "NodePool.h"
+
+// Forward declarations
 template<class T> class ListNode;
+template<class T> class Array;
+
+// Handling of the equal elements by the set operations of sorted lists
+enum class ListDuplicates{
+    Multiset,   // Equal elements are paired one to one, like std::set_union and the others
+    Unique      // Each value appears at most once in the result
+};
+
+// Whether the end of a range is its last element, true for the iterators of List
+template<class IteratorType, class = void>
+struct HasInclusiveEnd : std::false_type {};
+
+template<class IteratorType>
+struct HasInclusiveEnd<IteratorType, std::void_t<typename IteratorType::InclusiveEnd>> : std::true_type {};
 
 template<class T>
 class List{
@@ -95,11 +139,31 @@ public:
     void Merge(List<T>& anotherList);                           // Merges two sorted list
     void Concatenate(List<T>& anotherList);                     // Concatenates two lists
     void Splice(const iterator& destination, List<T>& anotherList);
+    size_t ShrinkToFit();                                       // Releases the node memory not needed by the elements
+
+    /*** Selection ***/
+    template<class Compare = std::less<T>>
+    void PartialSort(const size_t k, Compare compare = Compare());     // Relinks the k smallest elements to the front, in order
+    template<class Compare = std::less<T>>
+    void NthElement(const size_t n, Compare compare = Compare());      // Relinks the n + 1 smallest elements to the front, the n-th one last
+    template<class Compare = std::less<T>>
+    List<T> TopK(const size_t k, Compare compare = Compare()) const;   // Copies of the k smallest elements, in order
+
+    /*** Set Operations ***/
+    // Both lists must be sorted by the comparator, the result is kept in this list and the other one is flushed
+    template<class Compare = std::less<T>>
+    void SetUnion(List<T>& anotherList, const ListDuplicates duplicates = ListDuplicates::Multiset, Compare compare = Compare());
+    template<class Compare = std::less<T>>
+    void SetIntersection(List<T>& anotherList, const ListDuplicates duplicates = ListDuplicates::Multiset, Compare compare = Compare());
+    template<class Compare = std::less<T>>
+    void SetDifference(List<T>& anotherList, const ListDuplicates duplicates = ListDuplicates::Multiset, Compare compare = Compare());
+    template<class Compare = std::less<T>>
+    void SetSymmetricDifference(List<T>& anotherList, const ListDuplicates duplicates = ListDuplicates::Multiset, Compare compare = Compare());
 
     /*** Status Checkers ***/
     bool isEmpty() const        { return (numberOfNodes == 0);                  }
     size_t GetNodeCount() const { return numberOfNodes;                         }
-    bool isSorted() const       { return (!isEmpty() && firstPtr->isSorted());  }   // Recursively checks the status of each node
+    bool isSorted() const       { return (!isEmpty() && firstPtr->isSorted());  }   // Checks the order of each node
 
     /*** Operator Overloadings ***/
     bool operator==(const List<T>& anotherList) const    // Compare two lists by equality
@@ -113,10 +177,31 @@ public:
     template<class _T>
     friend std::ostream& operator<<(std::ostream& stream, List<_T>& list);
 
+    /*** Bulk Conversion ***/
+    template<class _T>
+    friend Array<_T> ToArray(List<_T>&& list);      // Moves the elements into an array, see ListArrayConversion.h
+    template<class _T>
+    friend List<_T> FromArray(Array<_T>&& array);   // Moves the elements into a list, see ListArrayConversion.h
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    /*** Allocation Tracking ***/
+    AllocationStatistics GetAllocationStatistics() const    // Node allocations made by this list
+    { return allocationProbe.GetStatistics(numberOfNodes * sizeof(ListNode<T>)); }
+    void ResetAllocationStatistics()
+    { allocationProbe.Reset(numberOfNodes * sizeof(ListNode<T>)); }
+#endif
+
+#if defined(CONTAINER_NODE_POOL)
+    /*** Node Pool ***/
+    NodePoolStatistics GetNodePoolStatistics() const { return nodePool.GetStatistics(); }
+#endif
+
     /*** Iterators ***/
     class iterator{
         friend class List;
     public:
+        using InclusiveEnd = void;  // List::end() is the last node, so the ranges include it
+
         iterator() = delete;    // There must be a node address to reach the list
         iterator(ListNode<T>* node) : node(node)
         { if(node == nullptr) throw std::logic_error("Iterator construction failed!"); }
@@ -171,10 +256,51 @@ private:
     void Prepend(ListNode<T>* baseNode, ListNode<T>* newNode);      // Prepending a node to a certain node
     void Append(ListNode<T>* baseNode, List<T>& anotherList);       // Appending a list to a certain node7
 
+    /*** Node Allocation ***/
+    template<class... Args>
+    ListNode<T>* CreateNode(Args&&... args);    // Allocates a node, every node of the list comes from here
+    void DestroyNode(ListNode<T>* node);        // Frees a node, every node of the list goes back from here
+    void TrackOwnership();                      // Reports the nodes taken over from another list
+    void TakeOverNodes(List<T>& anotherList);   // Called after all nodes of another list are linked into this one
+    void RelocateNode(ListNode<T>* node);       // Moves a node into a new slot, used by ShrinkToFit
+    bool DeferNodes();                          // Hands all nodes to the deferred reclaimer
+    static void DestroyElements(ListNode<T>* node);         // Runs the element destructors of a chain, without freeing
+    static void ReclaimChain(void* chain, size_t count);    // Frees a detached chain, run by the deferred reclaimer
+
+    /*** Bulk Conversion ***/
+    void MoveElementsTo(T* destination);                    // Moves every element out in order, the nodes are freed on the way
+    void AppendMoved(T* source, const size_t count);        // Appends the moved elements, nodes are carved in runs from the pool
+    void LinkLast(ListNode<T>* node);                       // Links a new node at the end, also into an empty list
+
+    /*** Selection ***/
+    template<class Compare>
+    std::vector<ListNode<T>*> SelectSmallest(const size_t k, Compare& compare) const;  // Max-heap of the k smallest nodes
+    void MoveToFront(const std::vector<ListNode<T>*>& nodes);                           // Relinks the nodes to the front, in the given order
+
+    /*** Set Operations ***/
+    template<class Compare>
+    bool isSortedBy(Compare& compare) const;                // Checks the order of each node with a comparator
+    template<class Compare>
+    void CombineSorted(List<T>& anotherList, const bool keepOnlyInThis, const bool keepOnlyInAnother,
+                       const bool keepCommon, const ListDuplicates duplicates, Compare& compare);
+
     /*** Members ***/
     ListNode<T>* firstPtr   = nullptr;  // First node of the list
     ListNode<T>* lastPtr    = nullptr;  // Last node of the list
     size_t numberOfNodes    = 0;        // Node count
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    AllocationProbe allocationProbe;    // Allocation counters of this list
+#endif
+
+#if defined(CONTAINER_NODE_POOL)
+    NodePool<ListNode<T>> nodePool;     // Blocks holding the nodes of this list
+
+    struct DetachedNodes{               // Nodes and blocks handed to the deferred reclaimer together
+        ListNode<T>* first = nullptr;
+        NodePool<ListNode<T>> pool;
+    };
+#endif
 };
 
 template<class T>
@@ -186,19 +312,17 @@ public:
     { /* Empty constructor */ }
 
     template<class... Args>
-    ListNode(Args&&... args): data(args...), prevPtr(nullptr), nextPtr(nullptr)
+    ListNode(Args&&... args): data(std::forward<Args>(args)...), prevPtr(nullptr), nextPtr(nullptr)
     { /* Empty constructor */ }
 
-    // Recursively checks the status of each node
+    // Checks the order of each node after this one, iteratively to keep long lists off the stack
     bool isSorted() const
     {
-        if(nextPtr == nullptr)
-            return true;
-
-        if(nextPtr->data < data)
-            return false;
+        for(const ListNode* node = this; node->nextPtr != nullptr; node = node->nextPtr)
+            if(node->nextPtr->data < node->data)
+                return false;
 
-        return nextPtr->isSorted();
+        return true;
     }
 
 private:
@@ -249,6 +373,10 @@ List<T>::List(const size_t n, Args&&... args)
  * @param   begin   Input iterator to the initial position in a range.
  * @param   end     Input iterator to the final position in a range.
  * @note    The begin iterator must placed prior to the end iterator.
+ * @note    The element at the end position is not included, as in the STL.
+ *          Single pass input iterators are supported, each element is read once.
+ * @note    Ranges of List iterators are the exception, they include the end position as List::end()
+ *          points to the last node. So List<T>(list.begin(), list.end()) copies the whole list.
  * @note    Template used for iterator type because the user may want to copy the items of a different type of container.
  *          Here is where the idea comes from : stackoverflow.com/questions/30121228
  */
@@ -257,17 +385,29 @@ template<class AnotherIteratorType>
 List<T>::List(AnotherIteratorType begin, AnotherIteratorType end)
 : firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0)
 {
-    AnotherIteratorType tempIt = begin;
-
     // Append all nodes in the range by copying its data members
-    while (true)
+    try
     {
-        EmplaceAppend(*tempIt);     // Append by inplace construction
+        if constexpr(HasInclusiveEnd<AnotherIteratorType>::value)
+        {
+            for(AnotherIteratorType tempIt = begin; ; ++tempIt)
+            {
+                EmplaceAppend(*tempIt);     // Append by inplace construction
 
-        if(tempIt != end)   // Continue until the last one is appended
-            tempIt++;
+                if(tempIt == end)   // Continue until the last one is appended
+                    break;
+            }
+        }
         else
-            break;
+        {
+            for(AnotherIteratorType tempIt = begin; tempIt != end; ++tempIt)
+                EmplaceAppend(*tempIt);     // Append by inplace construction
+        }
+    }
+    catch(...)
+    {
+        EraseAll();     // Destructor is not called for a partially constructed list
+        throw;
     }
 }
 
@@ -309,6 +449,8 @@ List<T>::List(List<T>&& anotherList)
     anotherList.firstPtr        = nullptr;
     anotherList.lastPtr         = nullptr;
     anotherList.numberOfNodes   = 0;
+
+    TakeOverNodes(anotherList);
 }
 
 /**
@@ -330,9 +472,13 @@ List<T>::List(std::initializer_list<T> initializerList)
 template<class T>
 List<T>::~List()
 {
-    /* Destroy all nodes until there is no node left. */
-    while(isEmpty() == false)
-        RemoveFirst();
+#if defined(CONTAINER_DEFERRED_RECLAMATION)
+    // Large lists hand the whole chain to the background reclaimer in O(1)
+    if(DeferNodes() == true)
+        return;
+#endif
+
+    EraseAll();
 }
 
 
@@ -346,12 +492,12 @@ List<T>& List<T>::Append(const T& data)
 {
     if(isEmpty() == true)  // If it is the first node
     {
-        firstPtr    = new ListNode<T>(data);    // Create the first node
+        firstPtr    = CreateNode(data);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        lastPtr->nextPtr = new ListNode<T>(data);   // Create and append the node
+        lastPtr->nextPtr = CreateNode(data);   // Create and append the node
         lastPtr->nextPtr->prevPtr = lastPtr;        // Adjust prevNode connection
         lastPtr = lastPtr->nextPtr;                 // Update the lastPtr
     }
@@ -372,12 +518,12 @@ List<T>& List<T>::Prepend(const T& data)
 {
     if(isEmpty() == true)   // If it is the first node
     {
-        firstPtr    = new ListNode<T>(data);    // Create the first node
+        firstPtr    = CreateNode(data);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        firstPtr->prevPtr = new ListNode<T>(data);  // Create and prepend the node
+        firstPtr->prevPtr = CreateNode(data);  // Create and prepend the node
         firstPtr->prevPtr->nextPtr = firstPtr;      // Adjust nextNode connection
         firstPtr = firstPtr->prevPtr;               // Update the firstPtr
     }
@@ -398,12 +544,12 @@ List<T>& List<T>::EmplaceAppend(Args&&... args)
 {
     if(isEmpty() == true)  // If it is the first node
     {
-        firstPtr    = new ListNode<T>(args...);    // Create the first node
+        firstPtr    = CreateNode(args...);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        lastPtr->nextPtr = new ListNode<T>(args...);    // Create and append the node
+        lastPtr->nextPtr = CreateNode(args...);    // Create and append the node
         lastPtr->nextPtr->prevPtr = lastPtr;            // Adjust prevNode connection
         lastPtr = lastPtr->nextPtr;                     // Update the lastPtr
     }
@@ -423,12 +569,12 @@ List<T>& List<T>::EmplacePrepend(Args&&... args)
 {
     if(isEmpty() == true)   // If it is the first node
     {
-        firstPtr    = new ListNode<T>(args...);    // Create the first node
+        firstPtr    = CreateNode(args...);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        firstPtr->prevPtr = new ListNode<T>(args...);   // Create and prepend the node
+        firstPtr->prevPtr = CreateNode(args...);   // Create and prepend the node
         firstPtr->prevPtr->nextPtr = firstPtr;          // Adjust nextNode connection
         firstPtr = firstPtr->prevPtr;                   // Update the firstPtr
     }
@@ -510,10 +656,13 @@ template<class T>
 template<class RuleT>
 List<T>& List<T>::RemoveIf(RuleT Predicate)
 {
+    CONTAINER_TRACE_SCOPE("List::RemoveIf", this, numberOfNodes);
+
     ListNode<T> *currentNode = firstPtr, *tempNode;
 
     while(currentNode != nullptr)
     {
+        CONTAINER_TRACE_HOPS(1);
         tempNode = currentNode->nextPtr;
 
         if(Predicate(currentNode->data) == true)
@@ -536,11 +685,13 @@ List<T>& List<T>::RemoveFirst()
     {
         ListNode<T>* tempPtr = firstPtr;    // Save removing node addresss
         firstPtr = firstPtr->nextPtr;       // Update firstPtr
-        delete tempPtr;                     // Delete saved firstPtr
+        DestroyNode(tempPtr);               // Delete saved firstPtr
         numberOfNodes--;                    // Decrement node count
 
         if(firstPtr != nullptr)
             firstPtr->prevPtr = nullptr;    // Remove prevNode connection
+        else
+            lastPtr = nullptr;              // List became empty, the last node was the removed one
     }
 
     return *this;   // Support cascaded remove calls
@@ -557,11 +708,13 @@ List<T>& List<T>::RemoveLast()
     {
         ListNode<T>* tempPtr = lastPtr;     // Save removing node addresss
         lastPtr = lastPtr->prevPtr;         // Update lastPtr
-        delete tempPtr;                     // Delete saved lastPtr
+        DestroyNode(tempPtr);               // Delete saved lastPtr
         numberOfNodes--;                    // Decrement node count
 
         if(lastPtr != nullptr)
             lastPtr->nextPtr = nullptr;    // Remove nextNode connection
+        else
+            firstPtr = nullptr;            // List became empty, the first node was the removed one
     }
 
     return *this;   // Support cascaded remove calls
@@ -664,9 +817,27 @@ List<T>& List<T>::RemoveLastNotOf(const T& data)
 template<class T>
 List<T>& List<T>::EraseAll()
 {
+#if defined(CONTAINER_NODE_POOL)
+    // Elements are destroyed in place and the blocks are freed at once, without per node frees
+    if(numberOfNodes != 0)
+        DestroyElements(firstPtr);
+
+    nodePool.Clear();
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    allocationProbe.OnFree(numberOfNodes * sizeof(ListNode<T>), numberOfNodes);
+#endif
+
+    firstPtr        = nullptr;
+    lastPtr         = nullptr;
+    numberOfNodes   = 0;
+#else
     /* Remove all until the list is empty */
     while(isEmpty() == false)
         RemoveFirst();
+#endif
+
+    return *this;
 }
 
 /**
@@ -747,6 +918,13 @@ void List<T>::Swap(List<T>& anotherList)
     tempSize                    = numberOfNodes;                // Save the size of this list
     numberOfNodes               = anotherList.numberOfNodes;    // Replace the size of this
     anotherList.numberOfNodes   = tempSize;                     // Replace the size of the other list
+
+#if defined(CONTAINER_NODE_POOL)
+    nodePool.Swap(anotherList.nodePool);    // Nodes stay in their blocks
+#endif
+
+    TrackOwnership();
+    anotherList.TrackOwnership();
 }
 
 /**
@@ -790,6 +968,8 @@ void List<T>::Unique()
 template<class T>
 void List<T>::Sort()
 {
+    CONTAINER_TRACE_SCOPE("List::Sort", this, numberOfNodes);
+
     // At least two nodes required for sorting
     if((isEmpty() == true) || (firstPtr == lastPtr))
         return;
@@ -824,6 +1004,8 @@ void List<T>::PrintAll(std::ostream& stream) const
 template<class T>
 void List<T>::Merge(List<T>& anotherList)
 {
+    CONTAINER_TRACE_SCOPE("List::Merge", this, numberOfNodes + anotherList.numberOfNodes);
+
     // Both of the lists must be sorted before merging
     if(isSorted() == false)
         Sort(); // Sort first
@@ -833,8 +1015,9 @@ void List<T>::Merge(List<T>& anotherList)
 
     ListNode<T> *currentNodeL1 = firstPtr, *currentNodeL2 = anotherList.firstPtr;
 
-    while(currentNodeL1 != nullptr)
+    while((currentNodeL1 != nullptr) && (anotherList.isEmpty() == false))
     {
+        CONTAINER_TRACE_HOPS(1);
         currentNodeL2 = anotherList.firstPtr;
         if(currentNodeL1->data > currentNodeL2->data)
         {
@@ -848,6 +1031,150 @@ void List<T>::Merge(List<T>& anotherList)
     // Concatenate remaining elements of other list as they are already sorted
     if(anotherList.isEmpty() == false)
         Concatenate(anotherList);
+
+    TakeOverNodes(anotherList); // Nodes moved one by one are reported here
+}
+
+/**
+ * @brief   Moves the k smallest elements to the front of the list in ascending order, in O(n log k).
+ * @param   k       Number of elements to be sorted, all elements are sorted if k is not less than the node count.
+ * @param   compare Strict weak ordering, std::less by default. std::greater selects the largest ones.
+ * @note    The winners are relinked, no element is copied. The other elements keep their relative order.
+ *          Equal elements are not guaranteed to keep their order.
+ */
+template<class T>
+template<class Compare>
+void List<T>::PartialSort(const size_t k, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("List::PartialSort", this, numberOfNodes);
+
+    std::vector<ListNode<T>*> winners = SelectSmallest(k, compare);
+
+    std::sort_heap(winners.begin(), winners.end(), [&compare](const ListNode<T>* left, const ListNode<T>* right)
+    { return compare(left->data, right->data); });
+
+    MoveToFront(winners);
+}
+
+/**
+ * @brief   Moves the element which would be at index n of the sorted list to index n, in O(N log n) for N nodes.
+ * @param   n       Zero based index
+ * @param   compare Strict weak ordering, std::less by default.
+ * @throws  std::range_error If n is not less than the node count.
+ * @note    The elements before index n are not greater than it, in an unspecified order.
+ *          The elements after it keep their relative order.
+ */
+template<class T>
+template<class Compare>
+void List<T>::NthElement(const size_t n, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("List::NthElement", this, numberOfNodes);
+
+    if(n >= numberOfNodes)
+    {
+        std::string errorMessage = "Out-of-Range Exception Occured ";
+                    errorMessage += "(Size = "  + std::to_string(numberOfNodes) + ") ";
+                    errorMessage += "(Index = " + std::to_string(n)             + ") ";
+        throw std::range_error(errorMessage);
+    }
+
+    std::vector<ListNode<T>*> winners = SelectSmallest(n + 1, compare);
+
+    // The top of the heap is the n-th element, it goes behind the others
+    std::pop_heap(winners.begin(), winners.end(), [&compare](const ListNode<T>* left, const ListNode<T>* right)
+    { return compare(left->data, right->data); });
+
+    MoveToFront(winners);
+}
+
+/**
+ * @brief   Copies the k smallest elements into a new list, in ascending order, in O(n log k).
+ * @param   k       Number of elements to be selected, all elements are copied if k is not less than the node count.
+ * @param   compare Strict weak ordering, std::less by default. std::greater selects the largest ones.
+ * @return  List of min(k, GetNodeCount()) elements, this list is left untouched.
+ */
+template<class T>
+template<class Compare>
+List<T> List<T>::TopK(const size_t k, Compare compare) const
+{
+    CONTAINER_TRACE_SCOPE("List::TopK", this, numberOfNodes);
+
+    std::vector<ListNode<T>*> winners = SelectSmallest(k, compare);
+
+    std::sort_heap(winners.begin(), winners.end(), [&compare](const ListNode<T>* left, const ListNode<T>* right)
+    { return compare(left->data, right->data); });
+
+    List<T> selected;
+    for(const ListNode<T>* node : winners)
+        selected.Append(node->data);
+
+    return selected;
+}
+
+/**
+ * @brief   Keeps the elements found in any of two sorted lists, in O(n + m).
+ * @param   anotherList Sorted list, flushed after this operation. Its nodes are relinked into this list.
+ * @param   duplicates  Multiset: an element found x times here and y times there is kept max(x, y) times.
+ *                      Unique: each value is kept once.
+ * @param   compare     Strict weak ordering both lists are sorted by, std::less by default.
+ * @throws  std::logic_error If any of the lists is not sorted by the comparator, both lists are left untouched.
+ * @note    No element is allocated or copied, the nodes which are not kept are destroyed.
+ */
+template<class T>
+template<class Compare>
+void List<T>::SetUnion(List<T>& anotherList, const ListDuplicates duplicates, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("List::SetUnion", this, numberOfNodes + anotherList.numberOfNodes);
+    CombineSorted(anotherList, true, true, true, duplicates, compare);
+}
+
+/**
+ * @brief   Keeps the elements found in both of two sorted lists, in O(n + m).
+ * @param   anotherList Sorted list, flushed after this operation.
+ * @param   duplicates  Multiset: an element found x times here and y times there is kept min(x, y) times.
+ *                      Unique: each value is kept once.
+ * @param   compare     Strict weak ordering both lists are sorted by, std::less by default.
+ * @throws  std::logic_error If any of the lists is not sorted by the comparator, both lists are left untouched.
+ * @note    The kept elements are the ones of this list.
+ */
+template<class T>
+template<class Compare>
+void List<T>::SetIntersection(List<T>& anotherList, const ListDuplicates duplicates, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("List::SetIntersection", this, numberOfNodes + anotherList.numberOfNodes);
+    CombineSorted(anotherList, false, false, true, duplicates, compare);
+}
+
+/**
+ * @brief   Keeps the elements of this list which are not found in another sorted list, in O(n + m).
+ * @param   anotherList Sorted list, flushed after this operation.
+ * @param   duplicates  Multiset: an element found x times here and y times there is kept max(x - y, 0) times.
+ *                      Unique: each value not found in the other list is kept once.
+ * @param   compare     Strict weak ordering both lists are sorted by, std::less by default.
+ * @throws  std::logic_error If any of the lists is not sorted by the comparator, both lists are left untouched.
+ */
+template<class T>
+template<class Compare>
+void List<T>::SetDifference(List<T>& anotherList, const ListDuplicates duplicates, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("List::SetDifference", this, numberOfNodes + anotherList.numberOfNodes);
+    CombineSorted(anotherList, true, false, false, duplicates, compare);
+}
+
+/**
+ * @brief   Keeps the elements found in only one of two sorted lists, in O(n + m).
+ * @param   anotherList Sorted list, flushed after this operation. Its nodes are relinked into this list.
+ * @param   duplicates  Multiset: an element found x times here and y times there is kept |x - y| times.
+ *                      Unique: each value found in only one of the lists is kept once.
+ * @param   compare     Strict weak ordering both lists are sorted by, std::less by default.
+ * @throws  std::logic_error If any of the lists is not sorted by the comparator, both lists are left untouched.
+ */
+template<class T>
+template<class Compare>
+void List<T>::SetSymmetricDifference(List<T>& anotherList, const ListDuplicates duplicates, Compare compare)
+{
+    CONTAINER_TRACE_SCOPE("List::SetSymmetricDifference", this, numberOfNodes + anotherList.numberOfNodes);
+    CombineSorted(anotherList, true, true, false, duplicates, compare);
 }
 
 /**
@@ -860,8 +1187,8 @@ void List<T>::Concatenate(List<T>& anotherList)
     if(anotherList.isEmpty() == true)
         return;
 
-    if(isEmpty() == true)
-        firstPtr = anotherList.firstPtr;
+    if(isEmpty() == true)   // Nothing to link, take over the nodes
+        return Swap(anotherList);
 
     // Link the first and last nodes
     anotherList.firstPtr->prevPtr = lastPtr;
@@ -877,6 +1204,8 @@ void List<T>::Concatenate(List<T>& anotherList)
     anotherList.firstPtr        = nullptr;
     anotherList.lastPtr         = nullptr;
     anotherList.numberOfNodes   = 0;
+
+    TakeOverNodes(anotherList);
 }
 
 /**
@@ -893,6 +1222,44 @@ void List<T>::Splice(const iterator& destination, List<T>& anotherList)
     Append(destination.node, anotherList);
 }
 
+/**
+ * @brief   Releases the node memory which is not needed by the current elements.
+ * @return  Number of bytes given back to the system allocator.
+ * @note    With the node pool (CONTAINER_NODE_POOL), the nodes of the sparse blocks are moved into the
+ *          densest blocks and the emptied blocks are freed. Without it every node is a separate
+ *          allocation freed together with its element, so there is nothing to release.
+ */
+template<class T>
+size_t List<T>::ShrinkToFit()
+{
+#if defined(CONTAINER_NODE_POOL)
+    if(nodePool.BeginCompaction() != 0)
+    {
+        try
+        {
+            for(ListNode<T>* node = firstPtr; node != nullptr; )
+            {
+                ListNode<T>* const next = node->nextPtr;
+
+                if(nodePool.IsEvacuating(node) == true)
+                    RelocateNode(node);
+
+                node = next;
+            }
+        }
+        catch(...)
+        {
+            nodePool.EndCompaction();   // Nodes not moved yet stay where they are
+            throw;
+        }
+    }
+
+    return nodePool.EndCompaction();
+#else
+    return 0;
+#endif
+}
+
 /**
  * @brief   Output insertion overloaded to be used with a list
  * @param   stream  Output stream where the list will be inserted to.
@@ -921,6 +1288,8 @@ std::ostream& operator<<(std::ostream& stream, List<T>& list)
 template<class T>
 ListNode<T>* List<T>::Find(const T& data, ListNode<T>* beginByNode)
 {
+    CONTAINER_TRACE_SCOPE("List::Find", this, numberOfNodes);
+
     // Search begins by the given node
     ListNode<T>* currentNode = beginByNode;
 
@@ -928,6 +1297,8 @@ ListNode<T>* List<T>::Find(const T& data, ListNode<T>* beginByNode)
      * or the last element is hit */
     while(currentNode != nullptr)
     {
+        CONTAINER_TRACE_HOPS(1);
+
         if(currentNode->data == data)
             break;
         else
@@ -1038,6 +1409,8 @@ ListNode<T>* List<T>::FindMinimum(ListNode<T>* beginByNode)
 
     while(currentNode != nullptr)
     {
+        CONTAINER_TRACE_HOPS(1);    // Counted for the enclosing Sort
+
         if(currentNode->data < minNode->data)
             minNode = currentNode;
 
@@ -1096,7 +1469,7 @@ void List<T>::RemoveNode(ListNode<T>* removingNode)
         removingNode->nextPtr->prevPtr = removingNode->prevPtr;
         removingNode->prevPtr->nextPtr = removingNode->nextPtr;
 
-        delete removingNode;    // Delete the node
+        DestroyNode(removingNode);  // Delete the node
         numberOfNodes--;        // Decrement node counter
     }
 }
@@ -1348,6 +1721,548 @@ void List<T>::Append(ListNode<T>* baseNode, List<T>& anotherList)
     anotherList.lastPtr     = nullptr;
     anotherList.numberOfNodes = 0;
 
+    TakeOverNodes(anotherList);
+}
+
+/**
+ * @brief   Allocates and constructs a node.
+ * @param   args    Arguments forwarded to the constructor of the element.
+ * @return  Address of the new node, not linked yet.
+ * @note    Counted by the allocation tracker, if it is enabled.
+ */
+template<class T>
+template<class... Args>
+ListNode<T>* List<T>::CreateNode(Args&&... args)
+{
+#if defined(CONTAINER_NODE_POOL)
+    void* const slot = nodePool.Allocate();
+    ListNode<T>* node;
+
+    try
+    {
+        node = new(slot) ListNode<T>(std::forward<Args>(args)...);
+    }
+    catch(...)
+    {
+        nodePool.Free(slot);    // The element constructor threw
+        throw;
+    }
+#else
+    ListNode<T>* node = new ListNode<T>(std::forward<Args>(args)...);
+#endif
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    allocationProbe.OnAllocate(sizeof(ListNode<T>), (numberOfNodes + 1) * sizeof(ListNode<T>));
+#endif
+
+    return node;
+}
+
+/**
+ * @brief   Destroys and frees a node.
+ * @param   node    Node to be destroyed, already unlinked from the list.
+ */
+template<class T>
+void List<T>::DestroyNode(ListNode<T>* node)
+{
+#if defined(CONTAINER_NODE_POOL)
+    node->~ListNode<T>();
+    nodePool.Free(node);
+#else
+    delete node;
+#endif
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    allocationProbe.OnFree(sizeof(ListNode<T>));
+#endif
+}
+
+/**
+ * @brief   Updates the peak of the owned bytes after nodes are taken over without an allocation.
+ */
+template<class T>
+inline void List<T>::TrackOwnership()
+{
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    allocationProbe.OnOwnershipChange(numberOfNodes * sizeof(ListNode<T>));
+#endif
+}
+
+/**
+ * @brief   Takes over the node memory of another list whose nodes were all linked into this one.
+ * @param   anotherList Emptied source list.
+ */
+template<class T>
+inline void List<T>::TakeOverNodes(List<T>& anotherList)
+{
+#if defined(CONTAINER_NODE_POOL)
+    nodePool.Adopt(anotherList.nodePool);   // Blocks follow their nodes
+#else
+    (void)anotherList;
+#endif
+
+    TrackOwnership();
+}
+
+/**
+ * @brief   Moves the element of a node into a new slot of the pool and relinks it.
+ * @param   node    Node of this list, destroyed and freed afterwards.
+ */
+template<class T>
+void List<T>::RelocateNode(ListNode<T>* node)
+{
+#if defined(CONTAINER_NODE_POOL)
+    void* const slot = nodePool.Allocate();
+    ListNode<T>* moved;
+
+    try
+    {
+        moved = new(slot) ListNode<T>(std::move_if_noexcept(node->data));
+    }
+    catch(...)
+    {
+        nodePool.Free(slot);    // The node stays where it is
+        throw;
+    }
+
+    moved->prevPtr = node->prevPtr;
+    moved->nextPtr = node->nextPtr;
+
+    if(node->prevPtr == nullptr)
+        firstPtr = moved;
+    else
+        node->prevPtr->nextPtr = moved;
+
+    if(node->nextPtr == nullptr)
+        lastPtr = moved;
+    else
+        node->nextPtr->prevPtr = moved;
+
+    node->~ListNode<T>();
+    nodePool.Free(node);
+#else
+    (void)node;
+#endif
+}
+
+/**
+ * @brief   Hands all nodes to the global deferred reclaimer, if the list is large enough.
+ * @return  true    If the list is empty now.
+ *          false   If the nodes are still owned by the list, e.g. the list is below the threshold.
+ * @note    With the node pool the blocks leave together with the chain. If the queue is full they are
+ *          reclaimed right away, which is still cheaper than freeing the nodes one by one.
+ */
+template<class T>
+bool List<T>::DeferNodes()
+{
+    DeferredReclaimer& reclaimer = DeferredReclaimer::Global();
+    const size_t bytes = numberOfNodes * sizeof(ListNode<T>);
+
+    if((isEmpty() == true) || (reclaimer.IsEnabled() == false) || (bytes < reclaimer.GetThreshold()))
+        return false;
+
+#if defined(CONTAINER_NODE_POOL)
+    DetachedNodes* const detached = new(std::nothrow) DetachedNodes();
+    if(detached == nullptr)
+        return false;
+
+    detached->first = firstPtr;
+    detached->pool.Swap(nodePool);
+
+    if(reclaimer.Defer(&List<T>::ReclaimChain, detached, numberOfNodes, bytes) == false)
+        ReclaimChain(detached, numberOfNodes);
+#else
+    if(reclaimer.Defer(&List<T>::ReclaimChain, firstPtr, numberOfNodes, bytes) == false)
+        return false;
+#endif
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+    allocationProbe.OnFree(bytes, numberOfNodes);
+#endif
+
+    firstPtr        = nullptr;
+    lastPtr         = nullptr;
+    numberOfNodes   = 0;
+
+    return true;
+}
+
+/**
+ * @brief   Runs the destructors of the elements of a chain, the memory is left to the caller.
+ * @param   node    First node of the chain, the chain ends with a nullptr.
+ * @note    Nothing is visited for trivially destructible elements.
+ */
+template<class T>
+void List<T>::DestroyElements(ListNode<T>* node)
+{
+    if constexpr(std::is_trivially_destructible<ListNode<T>>::value == false)
+    {
+        while(node != nullptr)
+        {
+            ListNode<T>* const next = node->nextPtr;
+            node->~ListNode<T>();
+            node = next;
+        }
+    }
+    else
+        (void)node;
+}
+
+/**
+ * @brief   Destroys and frees every node of a chain which no list owns anymore.
+ * @param   chain   First node of the chain, the chain ends with a nullptr.
+ *                  With the node pool, the DetachedNodes holding the chain and its blocks.
+ * @param   count   Number of nodes, unused as the chain is terminated.
+ * @note    Nodes of trivially destructible elements are only freed, with the sized deallocation,
+ *          or not visited at all with the node pool.
+ */
+template<class T>
+void List<T>::ReclaimChain(void* chain, size_t count)
+{
+    (void)count;
+
+#if defined(CONTAINER_NODE_POOL)
+    DetachedNodes* const detached = static_cast<DetachedNodes*>(chain);
+    DestroyElements(detached->first);
+    delete detached;    // Frees the blocks
+#else
+    ListNode<T>* node = static_cast<ListNode<T>*>(chain);
+
+    while(node != nullptr)
+    {
+        ListNode<T>* const next = node->nextPtr;
+
+        if constexpr(std::is_trivially_destructible<ListNode<T>>::value)
+            ::operator delete(node, sizeof(ListNode<T>));
+        else
+            delete node;
+
+        node = next;
+    }
+#endif
+}
+
+/**
+ * @brief   Moves the elements into consecutive slots and frees each node right after its element left,
+ *          so the list is walked only once.
+ * @param   destination First of GetNodeCount() assignable slots.
+ * @note    The list is empty afterwards. If a move assignment throws, the list keeps the nodes not moved yet.
+ * @note    With the node pool every freed slot goes back to its block, a block is released with its last node.
+ */
+template<class T>
+void List<T>::MoveElementsTo(T* destination)
+{
+    ListNode<T>* node = firstPtr;
+
+    try
+    {
+        while(node != nullptr)
+        {
+            ListNode<T>* const next = node->nextPtr;
+
+            *destination++ = std::move(node->data);
+            DestroyNode(node);
+
+            numberOfNodes--;
+            node = next;
+        }
+    }
+    catch(...)
+    {
+        firstPtr = node;    // The remaining nodes stay in the list
+        firstPtr->prevPtr = nullptr;
+        throw;
+    }
+
+    firstPtr    = nullptr;
+    lastPtr     = nullptr;
+}
+
+/**
+ * @brief   Appends the elements of a contiguous range by moving them into new nodes.
+ * @param   source  First element of the range, the elements are left moved-from.
+ * @param   count   Number of elements.
+ * @note    With the node pool the nodes are constructed in runs of consecutive slots (see NodePool::AllocateRun()),
+ *          so the chain is laid out in list order and a whole block is taken at once.
+ *          Otherwise every node is allocated by CreateNode.
+ * @note    If an element constructor throws, the nodes appended so far stay in the list.
+ */
+template<class T>
+void List<T>::AppendMoved(T* source, const size_t count)
+{
+#if defined(CONTAINER_NODE_POOL)
+    for(size_t index = 0; index < count; )
+    {
+        size_t granted  = 0;
+        char* slot      = static_cast<char*>(nodePool.AllocateRun(count - index, granted));
+
+        for(size_t run = 0; run < granted; run++, index++, slot += NodePool<ListNode<T>>::slotBytes)
+        {
+            ListNode<T>* node;
+
+            try
+            {
+                node = new(slot) ListNode<T>(std::move(source[index]));
+            }
+            catch(...)
+            {
+                for(; run < granted; run++, slot += NodePool<ListNode<T>>::slotBytes)
+                    nodePool.Free(slot);    // Slots of the run which were not constructed
+
+                throw;
+            }
+
+#if defined(CONTAINER_ALLOCATION_TRACKING)
+            allocationProbe.OnAllocate(sizeof(ListNode<T>), (numberOfNodes + 1) * sizeof(ListNode<T>));
+#endif
+
+            LinkLast(node);
+        }
+    }
+#else
+    for(size_t index = 0; index < count; index++)
+        LinkLast(CreateNode(std::move(source[index])));
+#endif
+}
+
+/**
+ * @brief   Links a new node after the last node, the list may be empty.
+ * @param   node    Unlinked node.
+ */
+template<class T>
+inline void List<T>::LinkLast(ListNode<T>* node)
+{
+    node->prevPtr = lastPtr;
+
+    if(lastPtr == nullptr)
+        firstPtr = node;
+    else
+        lastPtr->nextPtr = node;
+
+    lastPtr = node;
+    numberOfNodes++;
+}
+
+/**
+ * @brief   Checks the order of the nodes with the given comparator.
+ * @param   compare Strict weak ordering.
+ * @return  true If no node is less than its previous node, an empty list is sorted.
+ */
+template<class T>
+template<class Compare>
+bool List<T>::isSortedBy(Compare& compare) const
+{
+    for(const ListNode<T>* node = firstPtr; (node != nullptr) && (node->nextPtr != nullptr); node = node->nextPtr)
+        if(compare(node->nextPtr->data, node->data) == true)
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief   Walks two sorted chains once and relinks the kept nodes into this list, the rest is destroyed.
+ * @param   anotherList         Sorted list, flushed after this operation.
+ * @param   keepOnlyInThis      Keep the elements without an equal one in the other list.
+ * @param   keepOnlyInAnother   Keep the elements of the other list without an equal one in this list.
+ * @param   keepCommon          Keep one of each pair of equal elements, the one of this list.
+ * @param   duplicates          Multiset pairs the equal elements one to one, Unique handles each value once.
+ * @param   compare             Strict weak ordering both lists are sorted by.
+ * @throws  std::logic_error If any of the lists is not sorted by the comparator.
+ * @note    If the comparator throws, the nodes not visited yet are appended to this list unsorted, none is lost.
+ */
+template<class T>
+template<class Compare>
+void List<T>::CombineSorted(List<T>& anotherList, const bool keepOnlyInThis, const bool keepOnlyInAnother,
+                            const bool keepCommon, const ListDuplicates duplicates, Compare& compare)
+{
+    if((isSortedBy(compare) == false) || (anotherList.isSortedBy(compare) == false))
+        throw std::logic_error("Set operations require lists sorted by the comparator!");
+
+    if(&anotherList == this)    // Every element is common
+    {
+        if(keepCommon == false)
+            EraseAll();
+        else if(duplicates == ListDuplicates::Unique)
+        {
+            List<T> none;
+            CombineSorted(none, true, false, true, duplicates, compare);
+        }
+        else;
+
+        return;
+    }
+
+    ListNode<T>* left   = firstPtr;
+    ListNode<T>* right  = anotherList.firstPtr;
+
+    // Take over all nodes, the result is rebuilt from the kept ones
+    numberOfNodes += anotherList.numberOfNodes;
+    anotherList.firstPtr        = nullptr;
+    anotherList.lastPtr         = nullptr;
+    anotherList.numberOfNodes   = 0;
+
+    TakeOverNodes(anotherList);
+
+    firstPtr        = nullptr;
+    lastPtr         = nullptr;
+    numberOfNodes   = 0;
+
+    const bool unique = (duplicates == ListDuplicates::Unique);
+
+    // Links the node as the last one, or destroys it. In the unique mode a value equal to the last one is dropped
+    auto settle = [&](ListNode<T>* node, const bool keep)
+    {
+        if((keep == true) && ((unique == false) || (lastPtr == nullptr) || (compare(lastPtr->data, node->data) == true)))
+            LinkLast(node);
+        else
+            DestroyNode(node);
+    };
+
+    try
+    {
+        while((left != nullptr) && (right != nullptr))
+        {
+            CONTAINER_TRACE_HOPS(1);
+
+            if(compare(left->data, right->data) == true)
+            {
+                ListNode<T>* const next = left->nextPtr;
+                settle(left, keepOnlyInThis);
+                left = next;
+            }
+            else if(compare(right->data, left->data) == true)
+            {
+                ListNode<T>* const next = right->nextPtr;
+                settle(right, keepOnlyInAnother);
+                right = next;
+            }
+            else if(unique == false)    // Pair the equal elements one to one
+            {
+                ListNode<T>* const nextLeft     = left->nextPtr;
+                ListNode<T>* const nextRight    = right->nextPtr;
+
+                settle(left, keepCommon);
+                DestroyNode(right);
+
+                left    = nextLeft;
+                right   = nextRight;
+            }
+            else    // The value is found in both, every equal element of both lists is handled here
+            {
+                while((left->nextPtr != nullptr) && (compare(left->data, left->nextPtr->data) == false))
+                {
+                    ListNode<T>* const duplicate = left->nextPtr;
+                    left->nextPtr = duplicate->nextPtr;
+                    DestroyNode(duplicate);
+                }
+
+                while((right != nullptr) && (compare(left->data, right->data) == false))
+                {
+                    ListNode<T>* const next = right->nextPtr;
+                    DestroyNode(right);
+                    right = next;
+                }
+
+                ListNode<T>* const next = left->nextPtr;
+                settle(left, keepCommon);
+                left = next;
+            }
+        }
+
+        // Only one of the chains is left
+        while(left != nullptr)
+        {
+            ListNode<T>* const next = left->nextPtr;
+            settle(left, keepOnlyInThis);
+            left = next;
+        }
+
+        while(right != nullptr)
+        {
+            ListNode<T>* const next = right->nextPtr;
+            settle(right, keepOnlyInAnother);
+            right = next;
+        }
+    }
+    catch(...)
+    {
+        for(ListNode<T>* chain : {left, right})
+        {
+            while(chain != nullptr)
+            {
+                ListNode<T>* const next = chain->nextPtr;
+                LinkLast(chain);
+                chain = next;
+            }
+        }
+
+        if(lastPtr != nullptr)
+            lastPtr->nextPtr = nullptr;
+
+        throw;
+    }
+
+    if(lastPtr != nullptr)
+        lastPtr->nextPtr = nullptr;
+}
+
+/**
+ * @brief   Walks the list once and keeps the k smallest nodes seen so far in a bounded max-heap.
+ * @param   k       Heap capacity
+ * @param   compare Strict weak ordering of the elements.
+ * @return  Max-heap of min(k, GetNodeCount()) nodes, the greatest of the winners on the top.
+ * @note    A node replaces the top only if it is less, so the earlier one of equal elements wins.
+ */
+template<class T>
+template<class Compare>
+std::vector<ListNode<T>*> List<T>::SelectSmallest(const size_t k, Compare& compare) const
+{
+    std::vector<ListNode<T>*> heap;
+
+    if(k == 0)
+        return heap;
+
+    auto nodeCompare = [&compare](const ListNode<T>* left, const ListNode<T>* right)
+    { return compare(left->data, right->data); };
+
+    heap.reserve((k < numberOfNodes) ? k : numberOfNodes);
+
+    for(ListNode<T>* node = firstPtr; node != nullptr; node = node->nextPtr)
+    {
+        CONTAINER_TRACE_HOPS(1);
+
+        if(heap.size() < k)
+        {
+            heap.push_back(node);
+            std::push_heap(heap.begin(), heap.end(), nodeCompare);
+        }
+        else if(compare(node->data, heap.front()->data) == true)
+        {
+            std::pop_heap(heap.begin(), heap.end(), nodeCompare);
+            heap.back() = node;
+            std::push_heap(heap.begin(), heap.end(), nodeCompare);
+        }
+        else;
+    }
+
+    return heap;
+}
+
+/**
+ * @brief   Relinks the given nodes to the front of the list.
+ * @param   nodes   Distinct nodes of this list, the first one becomes the first node.
+ */
+template<class T>
+void List<T>::MoveToFront(const std::vector<ListNode<T>*>& nodes)
+{
+    for(auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+    {
+        if(*it == firstPtr)     // Already in place
+            continue;
+
+        DetachNode(*it);
+        Prepend(firstPtr, *it);
+    }
 }
 
 #endif  // Prevent recursive inclusion
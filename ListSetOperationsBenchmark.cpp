@@ -0,0 +1,122 @@
+// Description: Set operations of sorted Lists, nested searches against the linear relinking walk
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 ListSetOperationsBenchmark.cpp -o ListSetOperationsBenchmark
+//              (add -DCONTAINER_NODE_POOL to keep the rebuilt lists compact, with the default allocator the nodes
+//               freed by an interleaved result scatter the next lists over the heap and the later rows slow down)
+// Usage:       ./ListSetOperationsBenchmark [largest size]
+//              (default: 1048576, the nested searches stop at 16384)
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <optional>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "ListContainer.h"
+
+using namespace std;
+
+static const size_t repetitions = 3;
+
+// Whether the list contains the value, by walking it from the beginning
+static bool ContainsByWalk(List<int>& list, const int value)
+{
+    auto it = list.begin();
+
+    for(size_t index = 0; index < list.GetNodeCount(); index++, it++)
+        if(*it == value)
+            return true;
+
+    return false;
+}
+
+static void PrintRow(const char* operation, const char* method, const size_t size, const size_t resultSize, const double seconds)
+{
+    cout << setw(14) << left << operation << setw(14) << method << right << setw(10) << size << setw(10) << resultSize
+         << setw(14) << fixed << setprecision(3) << seconds * 1e3 << " ms" << endl;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t largest = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1048576;
+    mt19937 generator(11);
+
+    cout << setw(14) << left << "operation" << setw(14) << "method" << right << setw(10) << "size"
+         << setw(10) << "result" << setw(17) << "time" << endl;
+
+    for(size_t size = 1024; size <= largest; size *= 4)
+    {
+        // Two sorted lists of unique values, overlapping by about a half
+        vector<int> first(size), second(size);
+        for(size_t index = 0; index < size; index++)
+        {
+            first[index]    = static_cast<int>(generator() % (size * 3));
+            second[index]   = static_cast<int>(generator() % (size * 3));
+        }
+
+        for(vector<int>* values : {&first, &second})
+        {
+            sort(values->begin(), values->end());
+            values->erase(unique(values->begin(), values->end()), values->end());
+        }
+
+        optional<List<int>> left, right, result;
+
+        auto rebuild = [&]()
+        {
+            result.reset();
+            left.emplace(first.begin(), first.end());
+            right.emplace(second.begin(), second.end());
+        };
+
+        // The nested walks build a new list, the set operations leave the result in the left list
+        auto measure = [&](const char* operation, const char* method, const size_t runs, auto callable)
+        {
+            const double seconds = Benchmark::MeasureBest(runs, rebuild, callable);
+            PrintRow(operation, method, size, result.has_value() ? result->GetNodeCount() : left->GetNodeCount(), seconds);
+        };
+
+        // Today: a search in the other list for every element, the result is copied into a new list
+        if(size <= 16384)
+        {
+            measure("intersection", "nested walk", 1, [&]()
+            {
+                result.emplace();
+                auto it = left->begin();
+
+                for(size_t index = 0; index < left->GetNodeCount(); index++, it++)
+                    if(ContainsByWalk(*right, *it) == true)
+                        result->Append(*it);
+            });
+
+            measure("difference", "nested walk", 1, [&]()
+            {
+                result.emplace();
+                auto it = left->begin();
+
+                for(size_t index = 0; index < left->GetNodeCount(); index++, it++)
+                    if(ContainsByWalk(*right, *it) == false)
+                        result->Append(*it);
+            });
+        }
+
+        measure("union", "relinking", repetitions, [&]()
+        { left->SetUnion(*right); });
+
+        measure("intersection", "relinking", repetitions, [&]()
+        { left->SetIntersection(*right); });
+
+        measure("difference", "relinking", repetitions, [&]()
+        { left->SetDifference(*right); });
+
+        measure("symmetric", "relinking", repetitions, [&]()
+        { left->SetSymmetricDifference(*right); });
+    }
+
+    return 0;
+}
@@ -0,0 +1,326 @@
+/** @file       MappedFileOutputIterator.h
+ *  @details    Output to a memory mapped file.
+ *              The file is extended with ftruncate and mapped in windows which grow as the output grows.
+ *              Text is formatted straight into the mapped pages, so there is neither a stream buffer
+ *              copy nor a write system call per block. The file is truncated to its real size at close.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       MappedFileStreamBuf can be attached to an std::ostream, so the stream insertion
+ *              operators of Array and List write into the mapping as well.
+ *  @note       Only regular files can be mapped. Use FastOstreamIterator for pipes and terminals.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef MAPPED_FILE_OUTPUT_ITERATOR_H
+#define MAPPED_FILE_OUTPUT_ITERATOR_H
+
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "FastOstreamIterator.h"
+
+/**
+ * @brief   Stream buffer writing into a growing memory mapped window of a file.
+ */
+class MappedFileStreamBuf : public std::streambuf{
+public:
+    static constexpr size_t initialWindow   = 1  << 20;     // First mapping size
+    static constexpr size_t maximumWindow   = 64 << 20;     // Windows double up to this size
+
+    MappedFileStreamBuf(const std::string& path);   // Creates or truncates the file
+
+    MappedFileStreamBuf(const MappedFileStreamBuf&) = delete;
+    MappedFileStreamBuf& operator=(const MappedFileStreamBuf&) = delete;
+
+    ~MappedFileStreamBuf() override;    // Closes the file if not closed yet
+
+    char* Reserve(const size_t length);                     // Returns a write position with at least length bytes
+    void Commit(const size_t length) { Advance(length); }   // Commits the bytes written to the reserved space
+    void Close();                                           // Unmaps and truncates the file to its real size
+
+    size_t GetSize() const  { return windowOffset + ((mapping == nullptr) ? 0 : static_cast<size_t>(pptr() - mapping)); }
+    size_t GetRemapCount() const { return remapCount; }
+
+protected:
+    int_type overflow(int_type character) override;
+    std::streamsize xsputn(const char* data, std::streamsize length) override;
+    int sync() override { return 0; }   // Data is already in the page cache
+
+private:
+    void Remap(const size_t minimumFree);   // Moves the window to the current position
+    void Advance(size_t length);            // Moves the put pointer, lengths may exceed INT_MAX
+
+    int fileDescriptor  = -1;
+    char* mapping       = nullptr;  // Start of the current window
+    size_t windowOffset = 0;        // File offset of the window, page aligned
+    size_t windowLength = 0;        // Length of the current window
+    size_t fileLength   = 0;        // Length set by the last ftruncate
+    size_t nextWindow   = initialWindow;
+    size_t remapCount   = 0;
+    const size_t pageSize;
+};
+
+/**
+ * @brief   Opens the file and maps the first window.
+ * @param   path    Output file path, created or truncated.
+ * @throws  std::system_error When the file cannot be opened or mapped.
+ */
+inline MappedFileStreamBuf::MappedFileStreamBuf(const std::string& path)
+: pageSize(static_cast<size_t>(sysconf(_SC_PAGESIZE)))
+{
+    fileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if(fileDescriptor < 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+
+    setp(nullptr, nullptr);
+    Remap(0);
+}
+
+/**
+ * @brief   Destructor, closes the file.
+ * @note    Errors cannot be reported from a destructor, call Close() to observe them.
+ */
+inline MappedFileStreamBuf::~MappedFileStreamBuf()
+{
+    try         { Close(); }
+    catch(...)  { /* Nothing to do */ }
+}
+
+/**
+ * @brief   Makes sure there is enough room at the put position.
+ * @param   length  Required room in bytes.
+ * @return  Write position, Commit() must be called with the written amount.
+ * @throws  std::logic_error When the file is closed.
+ */
+inline char* MappedFileStreamBuf::Reserve(const size_t length)
+{
+    if(fileDescriptor < 0)
+        throw std::logic_error("Mapped file is closed!");
+
+    if(static_cast<size_t>(epptr() - pptr()) < length)
+        Remap(length);
+
+    return pptr();
+}
+
+/**
+ * @brief   Unmaps the window and truncates the file to the written size.
+ * @throws  std::system_error When the truncation or close fails.
+ */
+inline void MappedFileStreamBuf::Close()
+{
+    if(fileDescriptor < 0)
+        return;
+
+    const size_t size = GetSize();
+
+    if(mapping != nullptr)
+        ::munmap(mapping, windowLength);
+
+    mapping         = nullptr;
+    windowOffset    = size;   // Keeps GetSize() valid after the close
+    setp(nullptr, nullptr);
+
+    const int descriptor = fileDescriptor;
+    fileDescriptor = -1;
+
+    if(::ftruncate(descriptor, static_cast<off_t>(size)) != 0)
+    {
+        const int error = errno;
+        ::close(descriptor);
+        throw std::system_error(error, std::generic_category(), "Truncation failed!");
+    }
+
+    if(::close(descriptor) != 0)
+        throw std::system_error(errno, std::generic_category(), "Close failed!");
+}
+
+/**
+ * @brief   Called by the stream when the window is full.
+ * @param   character   Character to be written.
+ * @return  The character, or eof on failure.
+ */
+inline MappedFileStreamBuf::int_type MappedFileStreamBuf::overflow(int_type character)
+{
+    if(traits_type::eq_int_type(character, traits_type::eof()) == true)
+        return traits_type::not_eof(character);
+
+    try
+    {
+        *Reserve(1) = traits_type::to_char_type(character);
+        Advance(1);
+    }
+    catch(...)
+    {
+        return traits_type::eof();  // Stream turns into the bad state
+    }
+
+    return character;
+}
+
+/**
+ * @brief   Copies a block into the mapping, moving the window as often as needed.
+ * @param   data    Source characters.
+ * @param   length  Number of characters.
+ * @return  Number of characters written.
+ */
+inline std::streamsize MappedFileStreamBuf::xsputn(const char* data, std::streamsize length)
+{
+    std::streamsize written = 0;
+
+    try
+    {
+        while(written < length)
+        {
+            if(pptr() == epptr())
+                Reserve(1);
+
+            const size_t chunk = std::min(static_cast<size_t>(length - written), static_cast<size_t>(epptr() - pptr()));
+            std::memcpy(pptr(), data + written, chunk);
+            Advance(chunk);
+            written += static_cast<std::streamsize>(chunk);
+        }
+    }
+    catch(...)
+    { /* Report the partial write */ }
+
+    return written;
+}
+
+/**
+ * @brief   Maps a new window starting at the page of the current position.
+ * @param   minimumFree Room needed after the current position.
+ * @throws  std::system_error When the file cannot be extended or mapped.
+ * @note    The old window is released only after the new one is mapped. On a failure no window is left,
+ *          the put area is emptied and the position is kept, so Close() still keeps every written byte.
+ */
+inline void MappedFileStreamBuf::Remap(const size_t minimumFree)
+{
+    const size_t position   = (mapping == nullptr) ? windowOffset : GetSize();
+    const size_t newOffset  = position & ~(pageSize - 1);   // Offsets must be page aligned
+    const size_t lead       = position - newOffset;
+
+    // Windows grow geometrically, so large outputs need few remaps
+    size_t newLength = std::max(nextWindow, lead + minimumFree);
+    newLength = (newLength + pageSize - 1) & ~(pageSize - 1);
+
+    auto fail = [&](const int error, const char* message)
+    {
+        if(mapping != nullptr)
+            ::munmap(mapping, windowLength);
+
+        mapping         = nullptr;
+        windowOffset    = position;     // GetSize() reports the written bytes without a window
+        setp(nullptr, nullptr);
+
+        throw std::system_error(error, std::generic_category(), message);
+    };
+
+    if(newOffset + newLength > fileLength)
+    {
+        if(::ftruncate(fileDescriptor, static_cast<off_t>(newOffset + newLength)) != 0)
+            fail(errno, "File extension failed!");
+
+        fileLength = newOffset + newLength;
+    }
+
+    void* address = ::mmap(nullptr, newLength, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, static_cast<off_t>(newOffset));
+    if(address == MAP_FAILED)
+        fail(errno, "Mapping failed!");
+
+    if(mapping != nullptr)
+    {
+        ::munmap(mapping, windowLength);
+        remapCount++;
+    }
+
+    mapping         = static_cast<char*>(address);
+    windowOffset    = newOffset;
+    windowLength    = newLength;
+    nextWindow      = std::min(nextWindow * 2, maximumWindow);
+
+    setp(mapping, mapping + windowLength);
+    Advance(lead);  // Skip the part of the page already written
+}
+
+/**
+ * @brief   Moves the put pointer forward.
+ * @param   length  Number of bytes, may exceed the range of pbump.
+ */
+inline void MappedFileStreamBuf::Advance(size_t length)
+{
+    constexpr size_t maxStep = 1u << 30;
+
+    while(length > 0)
+    {
+        const size_t step = std::min(length, maxStep);
+        pbump(static_cast<int>(step));
+        length -= step;
+    }
+}
+
+/**
+ * @brief   Output iterator formatting values directly into the pages of a mapped file.
+ * @note    Copies of the iterator share the file. It is closed when the last copy is
+ *          destroyed or when Close() is called.
+ */
+template<class T>
+class MappedFileOutputIterator{
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+
+    MappedFileOutputIterator(const std::string& path, const char* delimiter = nullptr)
+    : file(std::make_shared<MappedFileStreamBuf>(path)), delimiter(delimiter != nullptr ? delimiter : "")
+    { /* Empty constructor */ }
+
+    MappedFileOutputIterator& operator=(const T& value)     // Formats the value followed by the delimiter
+    {
+        if constexpr(FastFormat::IsStringLike<T>::value)
+            file->sputn(std::string_view(value).data(), static_cast<std::streamsize>(std::string_view(value).size()));
+        else if constexpr(std::is_arithmetic<T>::value)
+        {
+            char* position = file->Reserve(FastFormat::maxArithmeticLength);
+            file->Commit(FastFormat::FormatTo(position, FastFormat::maxArithmeticLength, value));
+        }
+        else
+        {
+            std::ostream stream(file.get());    // Slow path for user defined types
+            stream << value;
+        }
+
+        file->sputn(delimiter.data(), static_cast<std::streamsize>(delimiter.size()));
+        return *this;
+    }
+
+    MappedFileOutputIterator& operator*()       { return *this; }   // No-op, as in std::ostream_iterator
+    MappedFileOutputIterator& operator++()      { return *this; }   // No-op, as in std::ostream_iterator
+    MappedFileOutputIterator& operator++(int)   { return *this; }   // No-op, as in std::ostream_iterator
+
+    void Close() { file->Close(); }     // Truncates the file to its real size
+
+    MappedFileStreamBuf& GetStreamBuf() { return *file; }   // Mixing with stream insertions is allowed
+
+private:
+    std::shared_ptr<MappedFileStreamBuf> file;  // Shared between the copies of the iterator
+    std::string_view delimiter;                 // Must outlive the iterator, like std::ostream_iterator
+};
+
+#endif  // Prevent recursive inclusion
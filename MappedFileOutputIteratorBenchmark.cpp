@@ -0,0 +1,122 @@
+// Description: Benchmark of memory mapped file output against ofstream and write(2)
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 MappedFileOutputIteratorBenchmark.cpp -o MappedFileOutputIteratorBenchmark
+// Usage:       ./MappedFileOutputIteratorBenchmark [elementCount] [filePath]
+//              (defaults: 20000000 and /tmp/MappedFileOutput.txt)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Benchmark.h"
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "FastOstreamIterator.h"
+#include "MappedFileOutputIterator.h"
+
+using namespace std;
+
+// Returns the content of the given file
+static string ReadAll(const char* path)
+{
+    ifstream file(path, ios::binary);
+    return string(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+// Prints a result row with the throughput in MB/s
+static void Report(const string& name, const double seconds, const size_t bytes)
+{
+    cout << setw(40) << left << name << right
+         << setw(10) << fixed << setprecision(3) << seconds << " s"
+         << setw(10) << setprecision(1) << (bytes / seconds) / 1e6 << " MB/s" << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t elementCount   = (argc > 1) ? stoull(argv[1]) : 20000000;
+    const char* path            = (argc > 2) ? argv[2] : "/tmp/MappedFileOutput.txt";
+    const size_t repetitions    = 3;
+
+    Array<int> array(elementCount);
+    mt19937 generator(11);
+    uniform_int_distribution<int> distribution(0, 1000000000);
+    for(int& element : array)
+        element = distribution(generator);
+
+    double seconds;
+
+    seconds = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        copy(array.begin(), array.end(), ostream_iterator<int>(file, " "));
+    });
+    const string reference = ReadAll(path);
+    Report("ostream_iterator -> ofstream", seconds, reference.size());
+
+    seconds = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        file << array;
+    });
+    Report("Array operator<< -> ofstream", seconds, reference.size());
+
+    seconds = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        copy(array.begin(), array.end(), FastOstreamIterator<int>(fd, " ", 1 << 20));
+        close(fd);
+    });
+    Report("FastOstreamIterator -> write(2)", seconds, reference.size());
+
+    size_t remaps = 0;
+    seconds = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        MappedFileOutputIterator<int> output(path, " ");
+        copy(array.begin(), array.end(), output);
+        remaps = output.GetStreamBuf().GetRemapCount();
+        output.Close();
+    });
+    Report("MappedFileOutputIterator", seconds, reference.size());
+    cout << "    remaps: " << remaps << ", identical: " << (ReadAll(path) == reference ? "yes" : "NO") << endl;
+
+    seconds = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        MappedFileStreamBuf buffer(path);
+        ostream stream(&buffer);
+        stream << array;
+        buffer.Close();
+    });
+    Report("Array operator<< -> MappedFileStreamBuf", seconds, reference.size());
+    cout << "    identical: " << (ReadAll(path) == reference ? "yes" : "NO") << endl;
+
+    // Lists go through the same stream buffer
+    List<int> list(array.begin(), array.begin() + min<size_t>(elementCount, 5000000));
+    seconds = Benchmark::MeasureBest(1, [&]()
+    {
+        ofstream file(path);
+        file << list;
+    });
+    cout << "List operator<< -> ofstream: " << fixed << setprecision(3) << seconds << " s" << endl;
+
+    seconds = Benchmark::MeasureBest(1, [&]()
+    {
+        MappedFileStreamBuf buffer(path);
+        ostream stream(&buffer);
+        stream << list;
+        buffer.Close();
+    });
+    cout << "List operator<< -> MappedFileStreamBuf: " << fixed << setprecision(3) << seconds << " s" << endl;
+
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,283 @@
+/** @file       MappedIstreamIterator.h
+ *  @details    Input counterpart of the mapped output: an istream_iterator-like reader over a memory mapped text file.
+ *              Tokens are separated by whitespace. Delimiters are searched 16 bytes at a time with SSE2
+ *              when available, numbers are parsed with std::from_chars and string tokens are returned
+ *              as std::string_view into the mapping, so no allocation is made per token.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       String views stay valid as long as the MappedInputFile they point into is alive.
+ *              Keep the shared file object while the views are used, e.g. in a List<std::string_view>.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef MAPPED_ISTREAM_ITERATOR_H
+#define MAPPED_ISTREAM_ITERATOR_H
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <iterator>
+#include <charconv>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief   Read-only memory mapping of a whole file.
+ */
+class MappedInputFile{
+public:
+    static std::shared_ptr<MappedInputFile> Open(const std::string& path)   // Shared ownership for the iterators
+    { return std::make_shared<MappedInputFile>(path); }
+
+    MappedInputFile(const std::string& path);
+
+    MappedInputFile(const MappedInputFile&) = delete;
+    MappedInputFile& operator=(const MappedInputFile&) = delete;
+
+    ~MappedInputFile();
+
+    const char* begin() const   { return data;          }
+    const char* end() const     { return data + size;   }
+    size_t GetSize() const      { return size;          }
+
+private:
+    const char* data    = nullptr;
+    size_t size         = 0;
+};
+
+/**
+ * @brief   Maps the given file.
+ * @param   path    File path.
+ * @throws  std::system_error When the file cannot be opened or mapped.
+ */
+inline MappedInputFile::MappedInputFile(const std::string& path)
+{
+    const int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+    if(fileDescriptor < 0)
+        throw std::system_error(errno, std::generic_category(), "Cannot open " + path);
+
+    struct stat status;
+    if(::fstat(fileDescriptor, &status) != 0)
+    {
+        const int error = errno;
+        ::close(fileDescriptor);
+        throw std::system_error(error, std::generic_category(), "Cannot stat " + path);
+    }
+
+    size = static_cast<size_t>(status.st_size);
+
+    if(size != 0)   // Empty files cannot be mapped
+    {
+        void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if(address == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close(fileDescriptor);
+            throw std::system_error(error, std::generic_category(), "Cannot map " + path);
+        }
+
+        ::madvise(address, size, MADV_SEQUENTIAL);  // Aggressive read-ahead
+        data = static_cast<const char*>(address);
+    }
+
+    ::close(fileDescriptor);    // The mapping keeps its own reference
+}
+
+/**
+ * @brief   Unmaps the file.
+ */
+inline MappedInputFile::~MappedInputFile()
+{
+    if(data != nullptr)
+        ::munmap(const_cast<char*>(data), size);
+}
+
+namespace TokenScan {
+
+inline bool IsDelimiter(const char character)
+{ return (character == ' ') || (character == '\n') || (character == '\r') || (character == '\t') ||
+         (character == '\v') || (character == '\f'); }
+
+#if defined(__SSE2__)
+/**
+ * @brief   Builds a mask of the delimiter bytes in a 16 byte block.
+ */
+inline unsigned DelimiterMask(const char* position)
+{
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+
+    // '\t', '\n', '\v', '\f' and '\r' are the consecutive codes 9 to 13
+    const __m128i shifted   = _mm_sub_epi8(block, _mm_set1_epi8(9));
+    const __m128i control   = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(4)), shifted);
+    const __m128i space     = _mm_cmpeq_epi8(block, _mm_set1_epi8(' '));
+
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(control, space)));
+}
+#endif
+
+/**
+ * @brief   Finds the first delimiter.
+ * @param   position    Search start.
+ * @param   end         Search end.
+ * @return  Position of the first delimiter, or end.
+ */
+inline const char* FindDelimiter(const char* position, const char* end)
+{
+#if defined(__SSE2__)
+    for(; end - position >= 16; position += 16)
+    {
+        const unsigned mask = DelimiterMask(position);
+        if(mask != 0)
+            return position + __builtin_ctz(mask);
+    }
+#endif
+
+    while((position != end) && (IsDelimiter(*position) == false))
+        position++;
+
+    return position;
+}
+
+/**
+ * @brief   Finds the first character which is not a delimiter.
+ * @param   position    Search start.
+ * @param   end         Search end.
+ * @return  Position of the first non-delimiter, or end.
+ */
+inline const char* SkipDelimiters(const char* position, const char* end)
+{
+    // Runs of delimiters are short, so the scalar check comes first
+    while((position != end) && (IsDelimiter(*position) == true))
+    {
+        position++;
+
+#if defined(__SSE2__)
+        // Long runs, e.g. indentation, are skipped a block at a time
+        while((end - position >= 16) && (DelimiterMask(position) == 0xFFFF))
+            position += 16;
+#endif
+    }
+
+    return position;
+}
+
+} // namespace TokenScan
+
+/**
+ * @brief   Input iterator over the whitespace separated tokens of a mapped file.
+ * @note    T can be an arithmetic type, std::string_view or std::string.
+ *          A default constructed iterator is the end iterator.
+ */
+template<class T>
+class MappedIstreamIterator{
+    static_assert((std::is_arithmetic<T>::value && !std::is_same<T, bool>::value) ||
+                  std::is_same<T, std::string_view>::value || std::is_same<T, std::string>::value,
+                  "MappedIstreamIterator supports numbers, std::string_view and std::string!");
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    MappedIstreamIterator() = default;  // End iterator
+
+    // The iterator is the only owner of the mapping, it is released once the end is reached
+    explicit MappedIstreamIterator(const std::string& path)
+    : MappedIstreamIterator(MappedInputFile::Open(path))
+    {
+        static_assert(!std::is_same<T, std::string_view>::value,
+                      "Views would outlive the mapping, open the file with MappedInputFile::Open and keep it alive!");
+    }
+
+    MappedIstreamIterator(std::shared_ptr<MappedInputFile> file)
+    : file(std::move(file))
+    {
+        if(this->file == nullptr)
+            throw std::logic_error("Mapped file cannot be NULL!");
+
+        position    = this->file->begin();
+        end         = this->file->end();
+        ReadNext();
+    }
+
+    const T& operator*() const  { return value;     }
+    const T* operator->() const { return &value;    }
+
+    MappedIstreamIterator& operator++()     // Parses the next token
+    {
+        ReadNext();
+        return *this;
+    }
+
+    MappedIstreamIterator operator++(int)   // Parses the next token, returns the previous state
+    {
+        MappedIstreamIterator previous = *this;
+        ReadNext();
+        return previous;
+    }
+
+    // Iterators are equal if both reached the end or both stand at the same token
+    bool operator==(const MappedIstreamIterator& anotherIt) const
+    { return (file == anotherIt.file) && (position == anotherIt.position); }
+    bool operator!=(const MappedIstreamIterator& anotherIt) const
+    { return !operator==(anotherIt); }
+
+private:
+    void ReadNext();
+
+    std::shared_ptr<MappedInputFile> file;  // nullptr once the end is reached
+    const char* position    = nullptr;      // Start of the unread part
+    const char* end         = nullptr;      // End of the mapping
+    T value{};                              // Last token
+};
+
+/**
+ * @brief   Parses the next token, turns into the end iterator when there is none.
+ * @throws  std::runtime_error When a token cannot be parsed as T entirely.
+ */
+template<class T>
+void MappedIstreamIterator<T>::ReadNext()
+{
+    if(file == nullptr)
+        return;
+
+    const char* tokenBegin = TokenScan::SkipDelimiters(position, end);
+    if(tokenBegin == end)
+    {
+        file        = nullptr;  // Becomes equal to the default constructed iterator
+        position    = nullptr;
+        return;
+    }
+
+    const char* tokenEnd = TokenScan::FindDelimiter(tokenBegin, end);
+    position = tokenEnd;
+
+    if constexpr(std::is_arithmetic<T>::value)
+    {
+        // from_chars rejects a leading '+', streams accept it
+        const char* numberBegin = ((*tokenBegin == '+') && (tokenEnd - tokenBegin > 1)) ? tokenBegin + 1 : tokenBegin;
+        const std::from_chars_result result = std::from_chars(numberBegin, tokenEnd, value);
+
+        if((result.ec != std::errc()) || (result.ptr != tokenEnd))
+            throw std::runtime_error("Invalid numeric token: " + std::string(tokenBegin, tokenEnd));
+    }
+    else
+        value = T(tokenBegin, static_cast<size_t>(tokenEnd - tokenBegin));
+}
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,104 @@
+// Description: Loading large text datasets with MappedIstreamIterator against istream_iterator
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 MappedIstreamIteratorBenchmark.cpp -o MappedIstreamIteratorBenchmark
+// Usage:       ./MappedIstreamIteratorBenchmark [elementCount] [filePath]
+//              (defaults: 20000000 and /tmp/MappedIstream.txt)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <random>
+#include <cstdio>
+
+#include "Benchmark.h"
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "FastOstreamIterator.h"
+#include "MappedIstreamIterator.h"
+
+using namespace std;
+
+// Prints a result row with the speedup against the reference
+static void Report(const string& name, const double seconds, const double reference)
+{
+    cout << setw(44) << left << name << right
+         << setw(10) << fixed << setprecision(3) << seconds << " s"
+         << setw(8) << setprecision(1) << reference / seconds << "x" << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t elementCount   = (argc > 1) ? stoull(argv[1]) : 20000000;
+    const char* path            = (argc > 2) ? argv[2] : "/tmp/MappedIstream.txt";
+
+    // Dataset: one integer per line, with a little indentation noise
+    {
+        mt19937 generator(3);
+        uniform_int_distribution<long> distribution(-1000000000, 1000000000);
+        ofstream file(path);
+        FastOstreamIterator<long> output(file, "\n");
+        for(size_t index = 0; index < elementCount; index++)
+            output = distribution(generator);
+    }
+
+    long checksum = 0, mappedChecksum = 0;
+
+    const double reference = Benchmark::MeasureBest(1, [&]()
+    {
+        ifstream file(path);
+        Array<long> loaded{istream_iterator<long>(file), istream_iterator<long>()};
+        checksum = 0;
+        for(long value : loaded)
+            checksum += value;
+    });
+    Report("istream_iterator<long> -> Array", reference, reference);
+
+    const double mapped = Benchmark::MeasureBest(1, [&]()
+    {
+        Array<long> loaded{MappedIstreamIterator<long>(path), MappedIstreamIterator<long>()};
+        mappedChecksum = 0;
+        for(long value : loaded)
+            mappedChecksum += value;
+    });
+    Report("MappedIstreamIterator<long> -> Array", mapped, reference);
+    cout << "    checksums match: " << (checksum == mappedChecksum ? "yes" : "NO") << endl;
+
+    const double listReference = Benchmark::MeasureBest(1, [&]()
+    {
+        ifstream file(path);
+        List<long> loaded{istream_iterator<long>(file), istream_iterator<long>()};
+        Benchmark::DoNotOptimize(loaded.GetNodeCount());
+    });
+    Report("istream_iterator<long> -> List", listReference, listReference);
+
+    const double listMapped = Benchmark::MeasureBest(1, [&]()
+    {
+        List<long> loaded{MappedIstreamIterator<long>(path), MappedIstreamIterator<long>()};
+        Benchmark::DoNotOptimize(loaded.GetNodeCount());
+    });
+    Report("MappedIstreamIterator<long> -> List", listMapped, listReference);
+
+    const double stringReference = Benchmark::MeasureBest(1, [&]()
+    {
+        ifstream file(path);
+        Array<string> loaded{istream_iterator<string>(file), istream_iterator<string>()};
+        Benchmark::DoNotOptimize(loaded.getSize());
+    });
+    Report("istream_iterator<string> -> Array", stringReference, stringReference);
+
+    const double stringMapped = Benchmark::MeasureBest(1, [&]()
+    {
+        shared_ptr<MappedInputFile> file = MappedInputFile::Open(path);     // Views point into this mapping
+        Array<string_view> loaded{MappedIstreamIterator<string_view>(file), MappedIstreamIterator<string_view>()};
+        Benchmark::DoNotOptimize(loaded.getSize());
+    });
+    Report("MappedIstreamIterator<string_view> -> Array", stringMapped, stringReference);
+
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,328 @@
+/** @file       MemoryTrim.h
+ *  @details    Process-wide memory trimming and a memory pressure monitor.
+ *              TrimProcess() runs the registered trim handlers (e.g. List::ShrinkToFit of the large lists
+ *              of the program), asks the C library to give its free pages back to the operating system
+ *              and reports how much memory was returned.
+ *              MemoryPressureMonitor polls the pressure stall information of the cgroup (memory.pressure)
+ *              and trims the process when the pressure exceeds a threshold.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Handlers run on the thread calling TrimProcess(), they must lock the containers they trim.
+ *  @note       Link with -pthread.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef MEMORY_TRIM_H
+#define MEMORY_TRIM_H
+
+#include <map>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#if defined(__unix__)
+#include <unistd.h>
+#endif
+
+/**
+ * @brief   Outcome of a process-wide trim.
+ */
+struct TrimResult{
+    size_t handlerBytes     = 0;        // Sum of the bytes reported by the handlers
+    size_t residentBefore   = 0;        // Resident set size before the trim, zero if unknown
+    size_t residentAfter    = 0;        // Resident set size after the trim, zero if unknown
+    bool allocatorTrimmed   = false;    // The C library reported that it released memory
+
+    size_t GetReturnedBytes() const     // Decrease of the resident set size
+    { return (residentBefore > residentAfter) ? residentBefore - residentAfter : 0; }
+
+    std::string ToText() const;         // Single line of key=value pairs
+};
+
+/**
+ * @brief   Formats the result as a log friendly line.
+ * @return  Text of the form "handler_bytes=... returned_bytes=... ...".
+ */
+inline std::string TrimResult::ToText() const
+{
+    std::ostringstream text;
+    text << "handler_bytes="        << handlerBytes
+         << " returned_bytes="      << GetReturnedBytes()
+         << " rss_before="          << residentBefore
+         << " rss_after="           << residentAfter
+         << " allocator_trimmed="   << (allocatorTrimmed ? "yes" : "no");
+
+    return text.str();
+}
+
+namespace MemoryTrim {
+
+using Handler = std::function<size_t()>;    // Releases memory, returns the bytes released
+
+namespace Detail {
+
+struct Registry{
+    std::mutex lock;
+    std::map<size_t, Handler> handlers;
+    size_t nextId = 1;
+};
+
+inline Registry registry;   // Shared by all translation units
+
+} // namespace Detail
+
+/**
+ * @brief   Registers a handler called by every TrimProcess().
+ * @param   handler Releases memory and returns the number of bytes released.
+ * @return  Identifier to be passed to RemoveHandler().
+ */
+inline size_t AddHandler(Handler handler)
+{
+    std::lock_guard<std::mutex> guard(Detail::registry.lock);
+
+    const size_t id = Detail::registry.nextId++;
+    Detail::registry.handlers.emplace(id, std::move(handler));
+
+    return id;
+}
+
+/**
+ * @brief   Unregisters a handler, e.g. before the container it trims is destroyed.
+ * @param   id  Identifier returned by AddHandler().
+ */
+inline void RemoveHandler(const size_t id)
+{
+    std::lock_guard<std::mutex> guard(Detail::registry.lock);
+    Detail::registry.handlers.erase(id);
+}
+
+/**
+ * @brief   Reads the resident set size of the process.
+ * @return  Bytes in physical memory, zero if unknown.
+ */
+inline size_t GetResidentBytes()
+{
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0, residentPages = 0;
+
+    if((statm >> totalPages >> residentPages).fail() == false)
+        return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+
+    return 0;
+}
+
+/**
+ * @brief   Runs the handlers and returns the free memory of the C library to the operating system.
+ * @return  Bytes released by the handlers and the decrease of the resident set size.
+ */
+inline TrimResult TrimProcess()
+{
+    TrimResult result;
+    result.residentBefore = GetResidentBytes();
+
+    {
+        // Held while the handlers run, so a handler cannot be removed in the middle of its call
+        std::lock_guard<std::mutex> guard(Detail::registry.lock);
+
+        for(auto& entry : Detail::registry.handlers)
+            result.handlerBytes += entry.second();
+    }
+
+#if defined(__GLIBC__)
+    result.allocatorTrimmed = (malloc_trim(0) != 0);
+#endif
+
+    result.residentAfter = GetResidentBytes();
+    return result;
+}
+
+} // namespace MemoryTrim
+
+/**
+ * @brief   Memory pressure stall information, percentages of the wall time.
+ */
+struct MemoryPressure{
+    bool available      = false;    // False if the file could not be read
+    double someAvg10    = 0;        // Some tasks stalled on memory, average of the last 10 seconds
+    double someAvg60    = 0;
+    double fullAvg10    = 0;        // All tasks stalled on memory, average of the last 10 seconds
+    uint64_t someTotal  = 0;        // Total stall time in microseconds
+
+    static MemoryPressure Read(const std::string& path = "");   // Cgroup file first, then the system wide one
+};
+
+/**
+ * @brief   Parses a pressure stall information file.
+ * @param   path    File to be read. If empty, the memory.pressure of the cgroup v2 root of the process
+ *                  is tried first, then /proc/pressure/memory.
+ * @return  Parsed values, available is false if no file could be read.
+ */
+inline MemoryPressure MemoryPressure::Read(const std::string& path)
+{
+    MemoryPressure pressure;
+
+    const char* const defaults[] = {"/sys/fs/cgroup/memory.pressure", "/proc/pressure/memory"};
+    std::ifstream file;
+
+    if(path.empty() == false)
+        file.open(path);
+    else
+    {
+        for(const char* candidate : defaults)
+        {
+            file.open(candidate);
+            if(file.is_open() == true)
+                break;
+
+            file.clear();
+        }
+    }
+
+    // Lines look like "some avg10=0.12 avg60=0.05 avg300=0.01 total=123456"
+    std::string line;
+    while(std::getline(file, line))
+    {
+        std::istringstream fields(line);
+        std::string kind, field;
+        fields >> kind;
+
+        while(fields >> field)
+        {
+            const size_t equal = field.find('=');
+            if(equal == std::string::npos)
+                continue;
+
+            const std::string key   = field.substr(0, equal);
+            const std::string value = field.substr(equal + 1);
+
+            if((kind == "some") && (key == "avg10"))
+                pressure.someAvg10 = std::strtod(value.c_str(), nullptr);
+            else if((kind == "some") && (key == "avg60"))
+                pressure.someAvg60 = std::strtod(value.c_str(), nullptr);
+            else if((kind == "some") && (key == "total"))
+                pressure.someTotal = std::strtoull(value.c_str(), nullptr, 10);
+            else if((kind == "full") && (key == "avg10"))
+                pressure.fullAvg10 = std::strtod(value.c_str(), nullptr);
+            else;
+        }
+
+        pressure.available = true;
+    }
+
+    return pressure;
+}
+
+/**
+ * @brief   Background thread trimming the process when the memory pressure is high.
+ */
+class MemoryPressureMonitor{
+public:
+    using Callback = std::function<void(const MemoryPressure&, const TrimResult&)>;     // Called after each trim
+
+    MemoryPressureMonitor(const double thresholdPercent, const std::chrono::milliseconds interval,
+                          Callback callback = nullptr, const std::string& path = "");
+    ~MemoryPressureMonitor();
+
+    MemoryPressureMonitor(const MemoryPressureMonitor&) = delete;
+    MemoryPressureMonitor& operator=(const MemoryPressureMonitor&) = delete;
+
+    size_t GetTrimCount() const;
+
+private:
+    void Run();
+
+    const double thresholdPercent;              // Trims when some avg10 reaches it
+    const std::chrono::milliseconds interval;   // Polling period, also the minimum time between trims
+    const Callback callback;
+    const std::string path;
+
+    mutable std::mutex lock;
+    std::condition_variable stopCondition;
+    bool stopRequested  = false;
+    size_t trims        = 0;
+
+    std::thread monitor;    // Declared last, starts after the other members
+};
+
+/**
+ * @brief   Starts polling the pressure.
+ * @param   thresholdPercent    Share of the time some tasks stalled on memory, e.g. 10 for 10%.
+ * @param   interval            Polling period.
+ * @param   callback            Optional, receives the pressure and the result of each trim.
+ * @param   path                Pressure file, see MemoryPressure::Read().
+ */
+inline MemoryPressureMonitor::MemoryPressureMonitor(const double thresholdPercent, const std::chrono::milliseconds interval,
+                                                    Callback callback, const std::string& path)
+: thresholdPercent(thresholdPercent), interval(interval), callback(std::move(callback)), path(path)
+{
+    monitor = std::thread(&MemoryPressureMonitor::Run, this);
+}
+
+/**
+ * @brief   Stops the polling thread.
+ */
+inline MemoryPressureMonitor::~MemoryPressureMonitor()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopRequested = true;
+    }
+
+    stopCondition.notify_one();
+    monitor.join();
+}
+
+/**
+ * @brief   Number of trims made so far.
+ */
+inline size_t MemoryPressureMonitor::GetTrimCount() const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return trims;
+}
+
+/**
+ * @brief   Polls the pressure until the monitor is destroyed.
+ */
+inline void MemoryPressureMonitor::Run()
+{
+    std::unique_lock<std::mutex> guard(lock);
+
+    while(stopCondition.wait_for(guard, interval, [this]() { return stopRequested; }) == false)
+    {
+        guard.unlock();
+
+        const MemoryPressure pressure = MemoryPressure::Read(path);
+        const bool trimmed = (pressure.available == true) && (pressure.someAvg10 >= thresholdPercent);
+
+        if(trimmed == true)
+        {
+            const TrimResult result = MemoryTrim::TrimProcess();
+
+            if(callback != nullptr)
+                callback(pressure, result);
+        }
+
+        guard.lock();
+        trims += trimmed ? 1 : 0;
+    }
+}
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,87 @@
+// Description: Returning the memory of drained lists to the operating system, on demand and under memory pressure
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread MemoryTrimDemo.cpp -o MemoryTrimDemo
+// Usage:       ./MemoryTrimDemo [nodes]
+//              (default: 4000000)
+
+// Lists allocate their nodes from per-list block pools, must be defined before any inclusion
+#define CONTAINER_NODE_POOL
+
+#include <iostream>
+#include <string>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+
+#include "ListContainer.h"
+#include "MemoryTrim.h"
+
+using namespace std;
+
+// Resident set size in MiB
+static double ResidentMiB()
+{
+    return MemoryTrim::GetResidentBytes() / (1024.0 * 1024.0);
+}
+
+int main(int argc, char** argv)
+{
+    const size_t nodes = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 4000000;
+
+    List<long> list;
+    mutex listLock;     // Trim handlers run on other threads
+
+    for(size_t index = 0; index < nodes; index++)
+        list.Append(static_cast<long>(index));
+
+    cout << "Filled:       rss=" << ResidentMiB() << " MiB, " << list.GetNodePoolStatistics().ToText() << endl;
+
+    // Keeps one node out of 64, every block stays partially used
+    list.RemoveIf([](long value) { return value % 64 != 0; });
+    cout << "Drained:      rss=" << ResidentMiB() << " MiB, " << list.GetNodePoolStatistics().ToText() << endl;
+
+    // Lists emptied from both ends give all their nodes back to their pools before being destroyed
+    {
+        List<string> strings;
+        for(size_t index = 0; index < 200; index++)
+            strings.Append(string(40, 'A'));
+
+        while(strings.isEmpty() == false)
+            strings.RemoveLast().RemoveFirst();
+
+        cout << "Emptied:      " << strings.GetNodePoolStatistics().ToText() << endl;
+    }
+
+    const size_t released = list.ShrinkToFit();
+    cout << "ShrinkToFit:  released=" << released << " bytes, " << list.GetNodePoolStatistics().ToText() << endl;
+
+    // The process-wide trim runs the handlers, then returns the free pages of the C library
+    const size_t handler = MemoryTrim::AddHandler([&]()
+    {
+        lock_guard<mutex> guard(listLock);
+        return list.ShrinkToFit();
+    });
+
+    const TrimResult result = MemoryTrim::TrimProcess();
+    cout << "TrimProcess:  rss=" << ResidentMiB() << " MiB, " << result.ToText() << endl;
+
+    const MemoryPressure pressure = MemoryPressure::Read();
+    if(pressure.available == true)
+        cout << "Pressure:     some avg10=" << pressure.someAvg10 << "% full avg10=" << pressure.fullAvg10 << "%" << endl;
+    else
+        cout << "Pressure:     not available on this system" << endl;
+
+    // A zero threshold trims on every poll, to show the callback
+    {
+        MemoryPressureMonitor monitor(0.0, chrono::milliseconds(50), [](const MemoryPressure& current, const TrimResult& trim)
+        { cout << "Monitor:      some avg10=" << current.someAvg10 << "% -> " << trim.ToText() << endl; });
+
+        this_thread::sleep_for(chrono::milliseconds(120));
+    }
+
+    MemoryTrim::RemoveHandler(handler);
+    return 0;
+}
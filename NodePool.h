@@ -0,0 +1,512 @@
+/** @file       NodePool.h
+ *  @details    Block pool for the nodes of a single container instance.
+ *              Nodes are carved out of aligned blocks, so the block of a node is found by masking its
+ *              address. A block is freed as soon as its last node is freed, and sparse blocks can be
+ *              evacuated by the owning container (see List::ShrinkToFit) so their memory goes back too.
+ *              When CONTAINER_NODE_POOL is defined, every List allocates its nodes from its own pool.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       A pool is not thread safe, like the container owning it.
+ *  @note       AllocateRun() hands out whole runs of a block, used by the bulk conversions (see ListArrayConversion.h).
+ *  @note       Nodes moved between containers by Swap, Concatenate, Splice or Merge take their blocks along,
+ *              see NodePool::Adopt().
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <new>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <utility>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief   Memory usage of a pool.
+ */
+struct NodePoolStatistics{
+    size_t blocks           = 0;    // Blocks allocated at the moment, including the spare one
+    size_t blockBytes       = 0;    // Size of a block
+    size_t reservedBytes    = 0;    // blocks * blockBytes
+    size_t liveNodes        = 0;    // Slots in use
+    size_t capacity         = 0;    // Slots of all blocks
+
+    std::string ToText() const;     // Single line of key=value pairs
+};
+
+/**
+ * @brief   Formats the statistics as a log friendly line.
+ * @return  Text of the form "blocks=... reserved_bytes=... ...".
+ */
+inline std::string NodePoolStatistics::ToText() const
+{
+    std::ostringstream text;
+    text << "blocks="           << blocks
+         << " block_bytes="     << blockBytes
+         << " reserved_bytes="  << reservedBytes
+         << " live_nodes="      << liveNodes
+         << " capacity="        << capacity;
+
+    return text.str();
+}
+
+/**
+ * @brief   Pool of equally sized node slots.
+ * @tparam  NodeType    Type of the nodes, only its size and alignment are used.
+ */
+template<class NodeType>
+class NodePool{
+private:
+    // Block header, the slots follow it within the same block
+    struct Block{
+        Block* prev             = nullptr;  // All blocks of the pool
+        Block* next             = nullptr;
+        Block* prevAvailable    = nullptr;  // Blocks with free slots, allocations are served from them
+        Block* nextAvailable    = nullptr;
+        void* freeList          = nullptr;  // Freed slots, linked through their first bytes
+        size_t used             = 0;        // Slots in use
+        size_t carved           = 0;        // Slots handed out at least once, the rest is untouched
+        bool available          = false;    // Linked into the available list
+        bool evacuating         = false;    // Nodes are being moved out by a compaction
+    };
+
+    static constexpr size_t RoundUp(const size_t value, const size_t alignment)
+    { return (value + alignment - 1) / alignment * alignment; }
+
+    static constexpr size_t slotAlignment   = (alignof(NodeType) > alignof(void*)) ? alignof(NodeType) : alignof(void*);
+    static constexpr size_t headerBytes     = RoundUp(sizeof(Block), slotAlignment);
+
+    static constexpr size_t BlockBytesFor(const size_t slot)    // Page sized, larger for huge nodes
+    {
+        size_t bytes = 4096;
+        while((bytes - headerBytes) / slot < 16)
+            bytes *= 2;
+        return bytes;
+    }
+
+public:
+    static constexpr size_t slotBytes       = RoundUp((sizeof(NodeType) > sizeof(void*)) ? sizeof(NodeType) : sizeof(void*), slotAlignment);
+    static constexpr size_t blockBytes      = BlockBytesFor(slotBytes);
+    static constexpr size_t slotsPerBlock   = (blockBytes - headerBytes) / slotBytes;
+
+    NodePool() = default;
+    NodePool(NodePool&& another) noexcept;
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    NodePool& operator=(NodePool&&) = delete;
+
+    void* Allocate();                   // Slot for a node, the node is constructed by the caller
+    void* AllocateRun(const size_t requested, size_t& granted);  // Consecutive slots of one block, for bulk construction
+    void Free(void* slot);              // The node must be destroyed already
+    void Clear();                       // Frees all blocks, every node must be destroyed already
+    void Adopt(NodePool& another);      // Takes over all blocks of another pool, the nodes stay where they are
+    void Swap(NodePool& another) noexcept;
+
+    /*** Compaction ***/
+    size_t BeginCompaction();           // Marks the sparse blocks to be evacuated, returns their count
+    bool IsEvacuating(const void* slot) const   { return BlockOf(slot)->evacuating; }
+    size_t EndCompaction();             // Frees the spare block, returns the bytes freed since BeginCompaction
+
+    NodePoolStatistics GetStatistics() const;
+
+private:
+    static Block* BlockOf(const void* slot)
+    { return reinterpret_cast<Block*>(reinterpret_cast<uintptr_t>(slot) & ~static_cast<uintptr_t>(blockBytes - 1)); }
+
+    static void* SlotAt(Block* block, const size_t index)
+    { return reinterpret_cast<char*>(block) + headerBytes + index * slotBytes; }
+
+    Block* NewBlock();
+    void ReleaseBlock(Block* block);    // Unlinks an empty block, keeps it as the spare or frees it
+    void PushAvailable(Block* block);
+    void RemoveAvailable(Block* block);
+
+    Block* first            = nullptr;  // All blocks in use, the spare one excluded
+    Block* last             = nullptr;
+    Block* availableHead    = nullptr;  // Blocks with free slots
+    Block* spare            = nullptr;  // One empty block kept to absorb alternating allocations and frees
+    size_t blocks           = 0;        // Blocks in use, the spare one excluded
+    size_t liveNodes        = 0;
+    size_t freedBytes       = 0;        // Bytes returned since the last BeginCompaction
+};
+
+/**
+ * @brief   Takes over the blocks of another pool.
+ * @param   another Source pool, left empty.
+ */
+template<class NodeType>
+NodePool<NodeType>::NodePool(NodePool&& another) noexcept
+{
+    Swap(another);
+}
+
+/**
+ * @brief   Frees all blocks, the nodes must have been destroyed by the owner.
+ */
+template<class NodeType>
+NodePool<NodeType>::~NodePool()
+{
+    Clear();
+}
+
+/**
+ * @brief   Hands out a slot, from the first block with free slots.
+ * @return  Uninitialized memory of slotBytes bytes.
+ * @throws  std::bad_alloc If a new block cannot be allocated.
+ */
+template<class NodeType>
+void* NodePool<NodeType>::Allocate()
+{
+    if(availableHead == nullptr)
+        PushAvailable(NewBlock());
+
+    Block* const block = availableHead;
+    void* slot;
+
+    if(block->freeList != nullptr)  // Reuse a freed slot first, it is likely in the cache
+    {
+        slot            = block->freeList;
+        block->freeList = *static_cast<void**>(slot);
+    }
+    else
+        slot = SlotAt(block, block->carved++);
+
+    if(++block->used == slotsPerBlock)
+        RemoveAvailable(block);
+
+    liveNodes++;
+    return slot;
+}
+
+/**
+ * @brief   Hands out consecutive slots of a single block, so a chain built from them is laid out in order.
+ * @param   requested   Number of slots wanted, at least one.
+ * @param   granted     Set to the number of slots handed out, between 1 and min(requested, slotsPerBlock).
+ * @return  First slot of the run, the next ones follow it by slotBytes.
+ * @throws  std::bad_alloc If a new block cannot be allocated.
+ * @note    Only the untouched tail of a block is handed out, a block with freed slots is skipped.
+ *          Slots of the run which are not constructed must be given back one by one with Free().
+ */
+template<class NodeType>
+void* NodePool<NodeType>::AllocateRun(const size_t requested, size_t& granted)
+{
+    Block* block = availableHead;
+
+    if((block == nullptr) || (block->freeList != nullptr) || (block->carved == slotsPerBlock))
+    {
+        block = NewBlock();
+        PushAvailable(block);
+    }
+
+    granted = std::min(std::max<size_t>(requested, 1), slotsPerBlock - block->carved);
+
+    void* const slot = SlotAt(block, block->carved);
+    block->carved  += granted;
+    block->used    += granted;
+    liveNodes      += granted;
+
+    if(block->used == slotsPerBlock)
+        RemoveAvailable(block);
+
+    return slot;
+}
+
+/**
+ * @brief   Gives a slot back, its block is released when it becomes empty.
+ * @param   slot    Slot returned by Allocate() of this pool or of an adopted one.
+ */
+template<class NodeType>
+void NodePool<NodeType>::Free(void* slot)
+{
+    Block* const block = BlockOf(slot);
+
+    *static_cast<void**>(slot)  = block->freeList;
+    block->freeList             = slot;
+    block->used--;
+    liveNodes--;
+
+    if(block->used == 0)
+        ReleaseBlock(block);
+    else if((block->available == false) && (block->evacuating == false))
+        PushAvailable(block);
+    else;
+}
+
+/**
+ * @brief   Frees every block at once, used when all nodes were destroyed without freeing their slots.
+ */
+template<class NodeType>
+void NodePool<NodeType>::Clear()
+{
+    for(Block* block = first; block != nullptr; )
+    {
+        Block* const next = block->next;
+        std::free(block);
+        block = next;
+    }
+
+    std::free(spare);   // Freeing a nullptr is safe
+
+    freedBytes     += (blocks + ((spare != nullptr) ? 1 : 0)) * blockBytes;
+    first           = nullptr;
+    last            = nullptr;
+    availableHead   = nullptr;
+    spare           = nullptr;
+    blocks          = 0;
+    liveNodes       = 0;
+}
+
+/**
+ * @brief   Moves all blocks of another pool into this one, without touching the nodes.
+ * @param   another Source pool, left empty. Its nodes now belong to this pool.
+ */
+template<class NodeType>
+void NodePool<NodeType>::Adopt(NodePool& another)
+{
+    if(&another == this)
+        return;
+
+    if(another.first != nullptr)
+    {
+        // Append the block list
+        if(last == nullptr)
+            first = another.first;
+        else
+        {
+            last->next          = another.first;
+            another.first->prev = last;
+        }
+
+        last = another.last;
+
+        // Prepend the available list, the blocks of the source are often emptier
+        if(another.availableHead != nullptr)
+        {
+            Block* tail = another.availableHead;
+            while(tail->nextAvailable != nullptr)
+                tail = tail->nextAvailable;
+
+            tail->nextAvailable = availableHead;
+            if(availableHead != nullptr)
+                availableHead->prevAvailable = tail;
+
+            availableHead = another.availableHead;
+        }
+    }
+
+    if(spare == nullptr)
+        spare = another.spare;
+    else
+        std::free(another.spare);
+
+    blocks      += another.blocks;
+    liveNodes   += another.liveNodes;
+
+    another.first           = nullptr;
+    another.last            = nullptr;
+    another.availableHead   = nullptr;
+    another.spare           = nullptr;
+    another.blocks          = 0;
+    another.liveNodes       = 0;
+}
+
+/**
+ * @brief   Exchanges the blocks of two pools.
+ * @param   another Pool to swap with.
+ */
+template<class NodeType>
+void NodePool<NodeType>::Swap(NodePool& another) noexcept
+{
+    std::swap(first, another.first);
+    std::swap(last, another.last);
+    std::swap(availableHead, another.availableHead);
+    std::swap(spare, another.spare);
+    std::swap(blocks, another.blocks);
+    std::swap(liveNodes, another.liveNodes);
+    std::swap(freedBytes, another.freedBytes);
+}
+
+/**
+ * @brief   Chooses the densest blocks able to hold all nodes and marks the others to be evacuated.
+ * @return  Number of blocks to be evacuated. The owner moves every node with IsEvacuating() into
+ *          a new slot from Allocate(), which is served by the kept blocks only.
+ */
+template<class NodeType>
+size_t NodePool<NodeType>::BeginCompaction()
+{
+    freedBytes = 0;
+
+    const size_t needed = (liveNodes + slotsPerBlock - 1) / slotsPerBlock;
+    if(needed >= blocks)
+        return 0;
+
+    std::vector<Block*> ordered;
+    ordered.reserve(blocks);
+    for(Block* block = first; block != nullptr; block = block->next)
+        ordered.push_back(block);
+
+    std::sort(ordered.begin(), ordered.end(), [](const Block* left, const Block* right)
+    { return left->used > right->used; });
+
+    for(size_t index = needed; index < ordered.size(); index++)
+    {
+        ordered[index]->evacuating = true;
+        if(ordered[index]->available == true)
+            RemoveAvailable(ordered[index]);
+    }
+
+    return ordered.size() - needed;
+}
+
+/**
+ * @brief   Finishes a compaction, blocks which could not be emptied are used again.
+ * @return  Bytes freed since BeginCompaction(), including the spare block.
+ */
+template<class NodeType>
+size_t NodePool<NodeType>::EndCompaction()
+{
+    for(Block* block = first; block != nullptr; block = block->next)
+    {
+        if(block->evacuating == true)
+        {
+            block->evacuating = false;
+            PushAvailable(block);   // Not full, some of its nodes were moved out
+        }
+    }
+
+    if(spare != nullptr)
+    {
+        std::free(spare);
+        spare       = nullptr;
+        freedBytes += blockBytes;
+    }
+
+    return freedBytes;
+}
+
+/**
+ * @brief   Takes a snapshot of the memory usage.
+ * @return  Block and slot counts.
+ */
+template<class NodeType>
+NodePoolStatistics NodePool<NodeType>::GetStatistics() const
+{
+    NodePoolStatistics statistics;
+
+    statistics.blocks           = blocks + ((spare != nullptr) ? 1 : 0);
+    statistics.blockBytes       = blockBytes;
+    statistics.reservedBytes    = statistics.blocks * blockBytes;
+    statistics.liveNodes        = liveNodes;
+    statistics.capacity         = statistics.blocks * slotsPerBlock;
+
+    return statistics;
+}
+
+/**
+ * @brief   Links a block into the pool, the spare one if there is.
+ * @return  Empty block.
+ * @throws  std::bad_alloc If the block cannot be allocated.
+ */
+template<class NodeType>
+typename NodePool<NodeType>::Block* NodePool<NodeType>::NewBlock()
+{
+    Block* block = spare;
+    spare = nullptr;
+
+    if(block == nullptr)
+    {
+        void* const memory = std::aligned_alloc(blockBytes, blockBytes);
+        if(memory == nullptr)
+            throw std::bad_alloc();
+
+        block = new(memory) Block();
+    }
+
+    block->prev = last;
+    if(last == nullptr)
+        first = block;
+    else
+        last->next = block;
+
+    last = block;
+    blocks++;
+
+    return block;
+}
+
+/**
+ * @brief   Unlinks an empty block. The first one is kept as the spare, the others are freed.
+ * @param   block   Block without any used slot.
+ */
+template<class NodeType>
+void NodePool<NodeType>::ReleaseBlock(Block* block)
+{
+    if(block->available == true)
+        RemoveAvailable(block);
+
+    if(block->prev == nullptr)
+        first = block->next;
+    else
+        block->prev->next = block->next;
+
+    if(block->next == nullptr)
+        last = block->prev;
+    else
+        block->next->prev = block->prev;
+
+    blocks--;
+
+    if((spare == nullptr) && (block->evacuating == false))
+        spare = new(block) Block();     // Reset, the slots are carved again
+    else
+    {
+        std::free(block);
+        freedBytes += blockBytes;
+    }
+}
+
+/**
+ * @brief   Makes the slots of a block available for allocations.
+ */
+template<class NodeType>
+void NodePool<NodeType>::PushAvailable(Block* block)
+{
+    block->available        = true;
+    block->prevAvailable    = nullptr;
+    block->nextAvailable    = availableHead;
+
+    if(availableHead != nullptr)
+        availableHead->prevAvailable = block;
+
+    availableHead = block;
+}
+
+/**
+ * @brief   Stops serving allocations from a block.
+ */
+template<class NodeType>
+void NodePool<NodeType>::RemoveAvailable(Block* block)
+{
+    if(block->prevAvailable == nullptr)
+        availableHead = block->nextAvailable;
+    else
+        block->prevAvailable->nextAvailable = block->nextAvailable;
+
+    if(block->nextAvailable != nullptr)
+        block->nextAvailable->prevAvailable = block->prevAvailable;
+
+    block->available        = false;
+    block->prevAvailable    = nullptr;
+    block->nextAvailable    = nullptr;
+}
+
+#endif  // Prevent recursive inclusion
@@ -1,12 +1,19 @@
 // Description: Examples of ostream_iterator's use cases
 // Date:        February 16, 2021
 // Author:      Caglayan DOKME
+// Update:      October 18, 2026 -> Buffered FastOstreamIterator example added.
+//                                  Asynchronous AsyncLogIterator example added. (Link with -pthread)
+//                                  I/O counters of an instrumented stream example added.
 
 #include <iostream>
 #include <iterator>
 #include <string>
 #include <vector>
 
+#include "FastOstreamIterator.h"
+#include "AsyncLogIterator.h"
+#include "InstrumentedStreamBuf.h"
+
 using namespace std;
 
 int main(int argc, char const *argv[])
@@ -39,6 +46,38 @@ int main(int argc, char const *argv[])
         errorLog = errorMessage;
     cout << endl;
 
+    /*  FastOstreamIterator is a drop-in replacement which formats into an internal buffer
+     *  and writes large blocks to the stream. The buffer is flushed when the last copy
+     *  of the iterator is destroyed or Flush() is called.
+     *  See FastOstreamIteratorBenchmark.cpp for the comparison with ostream_iterator. */
+    cout << "Printing integers with FastOstreamIterator: ";
+    FastOstreamIterator<int> fastScreenLog(cout, " ");
+    copy(array, array + 5, fastScreenLog);
+    fastScreenLog.Flush();
+    cout << endl;
+
+    /*  AsyncLogIterator pushes each record into a lock-free ring buffer and returns
+     *  immediately. A background thread of the sink writes the records in batches.
+     *  See AsyncLogIteratorBenchmark.cpp for the caller-side latencies. */
+    cout << "Printing errors with AsyncLogIterator: " << endl;
+    cout.flush();   // Sink writes to the descriptor directly, bypassing the stream buffers
+    AsyncLogSink errorSink(STDERR_FILENO, 1024, OverflowPolicy::Block);
+    copy(errors.begin(), errors.end(), AsyncLogIterator<string>(errorSink, "\r\n"));
+    errorSink.Flush();  // Destructor of the sink flushes as well
+    cout << endl;
+
+    /*  InstrumentedStreamBuf places itself in front of the buffer of a stream and counts
+     *  the bytes, the write calls, the flushes and the time spent blocked in the sink.
+     *  The original buffer is restored when the instrumentation goes out of scope.
+     *  See InstrumentedStreamBufBenchmark.cpp for the cost of the instrumentation. */
+    cout << "Printing errors to an instrumented stream: " << endl;
+    {
+        InstrumentedStreamBuf errorProbe(cerr, 0);  // Unbuffered, just like cerr itself
+        copy(errors.begin(), errors.end(), errorLog);
+        cout << "Counters: " << errorProbe.GetStatistics().ToJson() << endl;
+    }
+    cout << endl;
+
     cout << "Program ended!" << endl;
 
     return 0;
@@ -0,0 +1,325 @@
+/** @file       ParallelFormatter.h
+ *  @details    Pipelined text writer for large Array and List containers.
+ *              Worker threads format consecutive chunks of the container into separate buffers
+ *              while the calling thread writes the finished buffers out in the original order.
+ *              The number of buffers in flight is bounded, so a slow sink throttles the workers.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Output is identical to the stream insertion operators of the containers for
+ *              integral and string types: each element is followed by the delimiter.
+ *  @note       Link with -pthread.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef PARALLEL_FORMATTER_H
+#define PARALLEL_FORMATTER_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <algorithm>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "FastOstreamIterator.h"
+
+/**
+ * @brief   Tuning parameters of the pipeline.
+ */
+struct FormatPipelineOptions{
+    size_t threadCount      = 0;        // Formatting threads, zero selects the hardware concurrency
+    size_t chunkElements    = 65536;    // Elements formatted as a single unit
+    size_t maxInFlight      = 0;        // Chunk buffers alive at once, zero selects twice the thread count
+    const char* delimiter   = " ";      // Written after each element
+};
+
+namespace FormatPipelineDetail {
+
+/**
+ * @brief   Coordinates the formatting workers and the writer.
+ * @note    Chunk i is formatted into slot (i % maxInFlight). A worker may start chunk i only
+ *          after chunk (i - maxInFlight) has been written, which bounds the memory in use.
+ * @throws  std::system_error If a worker cannot be started, the started ones are stopped and joined first.
+ */
+template<class ClaimType, class FormatType>
+void Run(const size_t totalChunks, OutputBuffer& sink, const FormatPipelineOptions& options,
+         ClaimType claim, FormatType format)
+{
+    if(totalChunks == 0)
+        return;
+
+    size_t threadCount = (options.threadCount != 0) ? options.threadCount : std::thread::hardware_concurrency();
+    threadCount = std::max<size_t>(1, std::min(threadCount, totalChunks));
+
+    const size_t maxInFlight = std::max<size_t>(1, (options.maxInFlight != 0) ? options.maxInFlight : 2 * threadCount);
+
+    struct Slot{
+        std::string buffer;     // Formatted text, capacity is reused between chunks
+        size_t sequence = 0;    // Chunk stored in the slot
+        bool ready      = false;
+    };
+
+    std::vector<Slot> slots(maxInFlight);
+    std::mutex lock;
+    std::condition_variable slotFreed, slotReady;
+    size_t nextChunk = 0, writtenChunks = 0;
+    bool aborted = false;
+    std::exception_ptr error = nullptr;
+
+    auto worker = [&]()
+    {
+        try
+        {
+            while(true)
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                if((nextChunk == totalChunks) || (aborted == true))
+                    return;
+
+                const size_t chunk = nextChunk++;
+                auto range = claim(chunk);  // Claims are sequential, a list cursor may advance here
+
+                // Backpressure, wait until the slot of the chunk is written out
+                slotFreed.wait(guard, [&]() { return (chunk < writtenChunks + maxInFlight) || aborted; });
+                if(aborted == true)
+                    return;
+
+                guard.unlock();
+
+                Slot& slot = slots[chunk % maxInFlight];
+                slot.buffer.clear();
+                format(range, slot.buffer);
+
+                guard.lock();
+                slot.sequence   = chunk;
+                slot.ready      = true;
+                guard.unlock();
+
+                slotReady.notify_all();
+            }
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if(error == nullptr)
+                error = std::current_exception();
+            aborted = true;
+
+            slotFreed.notify_all();
+            slotReady.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    try
+    {
+        for(size_t index = 0; index < threadCount; index++)
+            workers.emplace_back(worker);
+    }
+    catch(...)
+    {
+        // Stops the started workers, they must be joined before the error leaves
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            aborted = true;
+        }
+
+        slotFreed.notify_all();
+        slotReady.notify_all();
+
+        for(std::thread& thread : workers)
+            thread.join();
+
+        throw;
+    }
+
+    // The calling thread is the single writer
+    try
+    {
+        for(size_t chunk = 0; chunk < totalChunks; chunk++)
+        {
+            Slot& slot = slots[chunk % maxInFlight];
+
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                slotReady.wait(guard, [&]() { return ((slot.ready == true) && (slot.sequence == chunk)) || aborted; });
+                if(aborted == true)
+                    break;
+            }
+
+            sink.Append(slot.buffer);   // Large chunks bypass the sink buffer
+
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                slot.ready = false;
+                writtenChunks++;
+            }
+            slotFreed.notify_all();
+        }
+
+        sink.Flush();
+    }
+    catch(...)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if(error == nullptr)
+            error = std::current_exception();
+        aborted = true;
+
+        slotFreed.notify_all();
+    }
+
+    for(std::thread& thread : workers)
+        thread.join();
+
+    if(error != nullptr)
+        std::rethrow_exception(error);
+}
+
+/**
+ * @brief   Formats an element followed by the delimiter.
+ */
+template<class T>
+inline void AppendFormatted(std::string& buffer, const T& value, std::string_view delimiter)
+{
+    char text[FastFormat::maxArithmeticLength];
+
+    if constexpr(FastFormat::IsStringLike<T>::value)
+        buffer.append(std::string_view(value));
+    else if constexpr(std::is_arithmetic<T>::value)
+        buffer.append(text, FastFormat::FormatTo(text, sizeof(text), value));
+    else
+    {
+        std::ostringstream formatter;   // Slow path for user defined types
+        formatter << value;
+        buffer.append(formatter.str());
+    }
+
+    buffer.append(delimiter);
+}
+
+/**
+ * @brief   Runs the pipeline over the index ranges of an array.
+ */
+template<class T>
+void FormatArray(const Array<T>& array, OutputBuffer& sink, const FormatPipelineOptions& options)
+{
+    const size_t size       = array.getSize();
+    const size_t chunkSize  = std::max<size_t>(1, options.chunkElements);
+    const std::string_view delimiter(options.delimiter != nullptr ? options.delimiter : "");
+
+    // A chunk of an array is simply an index range
+    auto claim = [&](const size_t chunk) -> std::pair<size_t, size_t>
+    { return {chunk * chunkSize, std::min(size, (chunk + 1) * chunkSize)}; };
+
+    auto format = [&](const std::pair<size_t, size_t>& range, std::string& buffer)
+    {
+        const T* elements = array.begin();
+        for(size_t index = range.first; index < range.second; index++)
+            AppendFormatted(buffer, elements[index], delimiter);
+    };
+
+    Run((size + chunkSize - 1) / chunkSize, sink, options, claim, format);
+}
+
+/**
+ * @brief   Runs the pipeline over the node ranges of a list.
+ */
+template<class T>
+void FormatList(List<T>& list, OutputBuffer& sink, const FormatPipelineOptions& options)
+{
+    if(list.isEmpty() == true)
+        return;
+
+    const size_t size       = list.GetNodeCount();
+    const size_t chunkSize  = std::max<size_t>(1, options.chunkElements);
+    const std::string_view delimiter(options.delimiter != nullptr ? options.delimiter : "");
+    typename List<T>::iterator cursor = list.begin();
+
+    // Chunks are claimed in order, the cursor walks to the start of the next chunk
+    auto claim = [&](const size_t chunk) -> std::pair<typename List<T>::iterator, size_t>
+    {
+        const size_t count = std::min(chunkSize, size - chunk * chunkSize);
+        std::pair<typename List<T>::iterator, size_t> range(cursor, count);
+
+        for(size_t step = 0; step < count; step++)
+            cursor++;
+
+        return range;
+    };
+
+    auto format = [&](std::pair<typename List<T>::iterator, size_t> range, std::string& buffer)
+    {
+        for(size_t step = 0; step < range.second; step++, range.first++)
+            AppendFormatted(buffer, *range.first, delimiter);
+    };
+
+    Run((size + chunkSize - 1) / chunkSize, sink, options, claim, format);
+}
+
+} // namespace FormatPipelineDetail
+
+/**
+ * @brief   Writes the array as text to the stream by formatting on multiple threads.
+ * @param   stream  Destination stream.
+ * @param   array   Array to be written.
+ * @param   options Pipeline parameters.
+ * @throws  Rethrows the first error of the workers or the writer.
+ */
+template<class T>
+void ParallelFormat(std::ostream& stream, const Array<T>& array, const FormatPipelineOptions& options = FormatPipelineOptions())
+{
+    OutputBuffer sink(stream);
+    FormatPipelineDetail::FormatArray(array, sink, options);
+}
+
+/**
+ * @brief   Writes the array as text to the file descriptor by formatting on multiple threads.
+ * @param   fileDescriptor  Destination descriptor, it is not closed.
+ * @param   array           Array to be written.
+ * @param   options         Pipeline parameters.
+ * @throws  Rethrows the first error of the workers or the writer.
+ */
+template<class T>
+void ParallelFormat(const int fileDescriptor, const Array<T>& array, const FormatPipelineOptions& options = FormatPipelineOptions())
+{
+    OutputBuffer sink(fileDescriptor);
+    FormatPipelineDetail::FormatArray(array, sink, options);
+}
+
+/**
+ * @brief   Writes the list as text to the stream by formatting on multiple threads.
+ * @param   stream  Destination stream.
+ * @param   list    List to be written, it must not be modified during the call.
+ * @param   options Pipeline parameters.
+ * @throws  Rethrows the first error of the workers or the writer.
+ */
+template<class T>
+void ParallelFormat(std::ostream& stream, List<T>& list, const FormatPipelineOptions& options = FormatPipelineOptions())
+{
+    OutputBuffer sink(stream);
+    FormatPipelineDetail::FormatList(list, sink, options);
+}
+
+/**
+ * @brief   Writes the list as text to the file descriptor by formatting on multiple threads.
+ * @param   fileDescriptor  Destination descriptor, it is not closed.
+ * @param   list            List to be written, it must not be modified during the call.
+ * @param   options         Pipeline parameters.
+ * @throws  Rethrows the first error of the workers or the writer.
+ */
+template<class T>
+void ParallelFormat(const int fileDescriptor, List<T>& list, const FormatPipelineOptions& options = FormatPipelineOptions())
+{
+    OutputBuffer sink(fileDescriptor);
+    FormatPipelineDetail::FormatList(list, sink, options);
+}
+
+#endif  // Prevent recursive inclusion
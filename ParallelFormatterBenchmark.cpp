@@ -0,0 +1,112 @@
+// Description: Scaling benchmark of the parallel formatting pipeline for large container dumps
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread ParallelFormatterBenchmark.cpp -o ParallelFormatterBenchmark
+// Usage:       ./ParallelFormatterBenchmark [elementCount] [outputPath]
+//              (defaults: 100000000 and /dev/null)
+//              Pass a regular file or a pipe (e.g. /dev/stdout | pv > /dev/null) to measure
+//              the scaling against the disk or pipe bandwidth.
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <random>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Benchmark.h"
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "FastOstreamIterator.h"
+#include "ParallelFormatter.h"
+
+using namespace std;
+
+// Prints a result row with the throughput in MB/s
+static void Report(const string& name, const double seconds, const size_t bytes, const double baseline)
+{
+    cout << setw(36) << left << name << right
+         << setw(10) << fixed << setprecision(3) << seconds << " s"
+         << setw(10) << setprecision(1) << (bytes / seconds) / 1e6 << " MB/s"
+         << setw(8) << setprecision(2) << baseline / seconds << "x" << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t elementCount   = (argc > 1) ? stoull(argv[1]) : 100000000;
+    const char* path            = (argc > 2) ? argv[2] : "/dev/null";
+
+    Array<int> array(elementCount);
+    mt19937 generator(7);
+    uniform_int_distribution<int> distribution(-1000000000, 1000000000);
+    for(int& element : array)
+        element = distribution(generator);
+
+    // Output size, measured once in memory
+    size_t bytes = 0;
+    {
+        FormatPipelineOptions options;
+        options.threadCount = 1;
+        ostringstream counter;
+        ParallelFormat(counter, array, options);
+        bytes = counter.str().size();
+    }
+
+    cout << "Array<int> with " << elementCount << " elements, " << bytes / 1e6 << " MB of text" << endl;
+
+    const double reference = Benchmark::MeasureBest(1, [&]()
+    {
+        ofstream file(path);
+        file << array;
+    });
+    Report("operator<< (ofstream)", reference, bytes, reference);
+
+    const double buffered = Benchmark::MeasureBest(1, [&]()
+    {
+        const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        copy(array.begin(), array.end(), FastOstreamIterator<int>(fd, " ", 1 << 20));
+        close(fd);
+    });
+    Report("FastOstreamIterator (fd)", buffered, bytes, reference);
+
+    const size_t maxThreads = max(1u, thread::hardware_concurrency());
+    for(size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        FormatPipelineOptions options;
+        options.threadCount = threads;
+
+        const double pipelined = Benchmark::MeasureBest(1, [&]()
+        {
+            const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            ParallelFormat(fd, array, options);
+            close(fd);
+        });
+        Report("ParallelFormat Array (" + to_string(threads) + " threads)", pipelined, bytes, reference);
+    }
+
+    // Lists are claimed by walking a shared cursor, the formatting itself is parallel
+    const size_t listCount = min<size_t>(elementCount, 10000000);
+    List<int> list(array.begin(), array.begin() + listCount);
+    for(size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        FormatPipelineOptions options;
+        options.threadCount = threads;
+
+        const double pipelined = Benchmark::MeasureBest(1, [&]()
+        {
+            const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            ParallelFormat(fd, list, options);
+            close(fd);
+        });
+        cout << "ParallelFormat List<int> (" << listCount << " nodes, " << threads << " threads): "
+             << fixed << setprecision(3) << pipelined << " s" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,250 @@
+/** @file       ParallelFunction.h
+ *  @details    Multi-threaded counterpart of the Function example in FuncWithLambdaArg.cpp.
+ *              The input is split into chunks which are filtered by a group of worker threads.
+ *              Matching elements are either collected in their original order or,
+ *              for maximum throughput, in an unspecified order.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Link with -pthread.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef PARALLEL_FUNCTION_H
+#define PARALLEL_FUNCTION_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ListContainer.h"
+
+/**
+ * @brief   Ordering policy of the filtered output.
+ */
+enum class FilterOrder{
+    Preserve,   // Output keeps the order of the input
+    Unordered   // Output order is unspecified, avoids per-chunk buffers
+};
+
+namespace ParallelDetail {
+
+constexpr size_t chunksPerWorker = 8;       // More chunks than workers balance uneven predicates
+constexpr size_t minimumChunkSize = 4096;   // Smaller chunks cost more in scheduling than they gain
+
+/**
+ * @brief   Determines the worker count to be used.
+ * @param   requested   Requested worker count, zero selects the hardware concurrency.
+ * @param   workload    Number of elements to be processed.
+ * @return  Worker count, at least one.
+ */
+inline size_t WorkerCount(const size_t requested, const size_t workload)
+{
+    size_t count = requested;
+
+    if(count == 0)
+        count = std::thread::hardware_concurrency();
+
+    if(count == 0)  // Hardware concurrency may be unknown
+        count = 1;
+
+    // There is no point in starting workers without work
+    const size_t maxUseful = (workload + minimumChunkSize - 1) / minimumChunkSize;
+    return std::max<size_t>(1, std::min(count, maxUseful));
+}
+
+/**
+ * @brief   Runs the given job on a group of threads and waits for all of them.
+ * @param   workerCount Number of workers, the calling thread is used as the last worker.
+ * @param   job         Callable taking the worker index.
+ * @throws  Rethrows the first exception thrown by any of the workers.
+ * @note    If a thread cannot be started (e.g. the thread limit is reached), the calling thread
+ *          runs the jobs of the missing workers itself. Each job still runs exactly once.
+ */
+template<class JobType>
+void RunOnWorkers(const size_t workerCount, JobType job)
+{
+    std::vector<std::thread> workers;
+    std::vector<std::exception_ptr> errors(workerCount);
+
+    auto guardedJob = [&job, &errors](const size_t workerIndex)
+    {
+        try                 { job(workerIndex); }
+        catch(...)          { errors[workerIndex] = std::current_exception(); }
+    };
+
+    workers.reserve(workerCount - 1);
+    for(size_t index = 0; index + 1 < workerCount; index++)
+    {
+        try         { workers.emplace_back(guardedJob, index); }
+        catch(...)  { break; }  // Started workers must still be joined, the rest runs here
+    }
+
+    // Calling thread takes its share as well, and the shares of the workers not started
+    for(size_t index = workers.size(); index < workerCount; index++)
+        guardedJob(index);
+
+    for(std::thread& worker : workers)
+        worker.join();
+
+    for(const std::exception_ptr& error : errors)
+        if(error != nullptr)
+            std::rethrow_exception(error);
+}
+
+} // namespace ParallelDetail
+
+/**
+ * @brief   Collects the elements fulfilling the lambda by using multiple threads.
+ * @param   container   Random access container to be filtered.
+ * @param   lambda      Unary predicate, must be safe to call concurrently.
+ * @param   order       Ordering policy of the output.
+ * @param   threadCount Worker count, zero selects the hardware concurrency.
+ * @return  Elements for which the lambda returned true.
+ * @note    Preserve mode filters each chunk into its own buffer and places the buffers
+ *          into the output by using the prefix sum of their sizes. The copy is parallel too.
+ * @note    Unordered mode keeps a single buffer per worker, so no chunk bookkeeping is needed.
+ */
+template<typename ContainerType, typename LambdaType>
+auto ParallelFunction(const ContainerType& container, LambdaType lambda,
+                      const FilterOrder order = FilterOrder::Preserve, const size_t threadCount = 0)
+-> std::vector<typename std::decay<decltype(*std::begin(container))>::type>
+{
+    using IteratorType  = decltype(std::begin(container));
+    using ElementType   = typename std::decay<decltype(*std::begin(container))>::type;
+
+    static_assert(std::is_base_of<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<IteratorType>::iterator_category>::value,
+                  "ParallelFunction requires a random access container!");
+
+    const IteratorType first = std::begin(container);
+    const size_t size        = static_cast<size_t>(std::distance(first, std::end(container)));
+    const size_t workerCount = ParallelDetail::WorkerCount(threadCount, size);
+
+    std::vector<ElementType> result;
+    if(size == 0)
+        return result;
+
+    const size_t chunkCount = std::min(workerCount * ParallelDetail::chunksPerWorker,
+                                       (size + ParallelDetail::minimumChunkSize - 1) / ParallelDetail::minimumChunkSize);
+    const size_t chunkSize  = (size + chunkCount - 1) / chunkCount;
+    std::atomic<size_t> nextChunk(0);   // Chunks are handed out dynamically
+
+    // Filters a single chunk into the given buffer
+    auto filterChunk = [&](const size_t chunk, std::vector<ElementType>& buffer)
+    {
+        const size_t begin  = chunk * chunkSize;
+        const size_t end    = std::min(size, begin + chunkSize);
+
+        for(IteratorType it = first + begin; it != first + end; ++it)
+            if(lambda(*it) == true)
+                buffer.push_back(*it);
+    };
+
+    if(order == FilterOrder::Unordered)
+    {
+        std::vector<std::vector<ElementType>> workerBuffers(workerCount);
+
+        ParallelDetail::RunOnWorkers(workerCount, [&](const size_t worker)
+        {
+            for(size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+                filterChunk(chunk, workerBuffers[worker]);
+        });
+
+        size_t total = 0;
+        for(const std::vector<ElementType>& buffer : workerBuffers)
+            total += buffer.size();
+
+        result.reserve(total);
+        for(std::vector<ElementType>& buffer : workerBuffers)
+            std::move(buffer.begin(), buffer.end(), std::back_inserter(result));
+
+        return result;
+    }
+
+    // Preserve the order: one buffer per chunk
+    std::vector<std::vector<ElementType>> chunkBuffers(chunkCount);
+
+    ParallelDetail::RunOnWorkers(workerCount, [&](const size_t)
+    {
+        for(size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+            filterChunk(chunk, chunkBuffers[chunk]);
+    });
+
+    // Exclusive prefix sum of chunk sizes gives the output offset of each chunk
+    std::vector<size_t> offsets(chunkCount + 1, 0);
+    for(size_t chunk = 0; chunk < chunkCount; chunk++)
+        offsets[chunk + 1] = offsets[chunk] + chunkBuffers[chunk].size();
+
+    result.resize(offsets[chunkCount]);
+    nextChunk = 0;
+
+    ParallelDetail::RunOnWorkers(workerCount, [&](const size_t)
+    {
+        for(size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+            std::move(chunkBuffers[chunk].begin(), chunkBuffers[chunk].end(), result.begin() + offsets[chunk]);
+    });
+
+    return result;
+}
+
+/**
+ * @brief   Collects the elements fulfilling the lambda into a List by using multiple threads.
+ * @param   container   Random access container to be filtered.
+ * @param   lambda      Unary predicate, must be safe to call concurrently.
+ * @param   threadCount Worker count, zero selects the hardware concurrency.
+ * @return  List of the elements for which the lambda returned true, in the original order.
+ * @note    Each chunk builds its own node chain, the chains are then concatenated
+ *          in order. No element is copied after the filtering step.
+ */
+template<typename ContainerType, typename LambdaType>
+auto ParallelFunctionToList(const ContainerType& container, LambdaType lambda, const size_t threadCount = 0)
+-> List<typename std::decay<decltype(*std::begin(container))>::type>
+{
+    using IteratorType  = decltype(std::begin(container));
+    using ElementType   = typename std::decay<decltype(*std::begin(container))>::type;
+
+    static_assert(std::is_base_of<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<IteratorType>::iterator_category>::value,
+                  "ParallelFunctionToList requires a random access container!");
+
+    const IteratorType first = std::begin(container);
+    const size_t size        = static_cast<size_t>(std::distance(first, std::end(container)));
+    const size_t workerCount = ParallelDetail::WorkerCount(threadCount, size);
+
+    List<ElementType> result;
+    if(size == 0)
+        return result;
+
+    const size_t chunkCount = std::min(workerCount * ParallelDetail::chunksPerWorker,
+                                       (size + ParallelDetail::minimumChunkSize - 1) / ParallelDetail::minimumChunkSize);
+    const size_t chunkSize  = (size + chunkCount - 1) / chunkCount;
+    std::vector<List<ElementType>> chunkLists(chunkCount);
+    std::atomic<size_t> nextChunk(0);
+
+    ParallelDetail::RunOnWorkers(workerCount, [&](const size_t)
+    {
+        for(size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+        {
+            const size_t begin  = chunk * chunkSize;
+            const size_t end    = std::min(size, begin + chunkSize);
+
+            for(IteratorType it = first + begin; it != first + end; ++it)
+                if(lambda(*it) == true)
+                    chunkLists[chunk].Append(*it);
+        }
+    });
+
+    // Splice the chains in their original order, no node is copied
+    for(List<ElementType>& chunkList : chunkLists)
+        result.Concatenate(chunkList);
+
+    return result;
+}
+
+#endif  // Prevent recursive inclusion
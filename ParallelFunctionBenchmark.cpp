@@ -0,0 +1,79 @@
+// Description: Scaling benchmark of ParallelFunction against the single threaded filter
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread ParallelFunctionBenchmark.cpp -o ParallelFunctionBenchmark
+// Usage:       ./ParallelFunctionBenchmark [elementCount]   (default 100000000)
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+
+#include "Benchmark.h"
+#include "ParallelFunction.h"
+
+using namespace std;
+
+int main(int argc, char const *argv[])
+{
+    const size_t elementCount = (argc > 1) ? stoull(argv[1]) : 100000000;
+    const size_t repetitions  = 3;
+
+    vector<int> input(elementCount);
+    iota(input.begin(), input.end(), 0);
+
+    auto lambda = [](int value) { return ((value % 3) == 0); };  // Keeps one third of the input
+
+    // Single threaded reference
+    vector<int> reference;
+    const double sequential = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        reference.clear();
+        copy_if(input.begin(), input.end(), back_inserter(reference), lambda);
+        Benchmark::DoNotOptimize(reference.data());
+    });
+
+    cout << "Elements: " << elementCount << ", selected: " << reference.size() << endl;
+    cout << "Sequential copy_if: " << fixed << setprecision(4) << sequential << " s" << endl << endl;
+
+    cout << setw(8) << "Threads" << setw(14) << "Ordered(s)" << setw(10) << "Speedup"
+         << setw(14) << "Unordered(s)" << setw(10) << "Speedup"
+         << setw(12) << "List(s)"  << setw(10) << "Speedup" << endl;
+
+    const size_t maxThreads = max(1u, thread::hardware_concurrency());
+    for(size_t threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        vector<int> ordered, unordered;
+
+        const double orderedTime = Benchmark::MeasureBest(repetitions, [&]()
+        { ordered = ParallelFunction(input, lambda, FilterOrder::Preserve, threads); });
+
+        const double unorderedTime = Benchmark::MeasureBest(repetitions, [&]()
+        { unordered = ParallelFunction(input, lambda, FilterOrder::Unordered, threads); });
+
+        const double listTime = Benchmark::MeasureBest(1, [&]()
+        {
+            List<int> result = ParallelFunctionToList(input, lambda, threads);
+            Benchmark::DoNotOptimize(result.GetNodeCount());
+        });
+
+        // Sanity check, the ordered output must be identical to the reference
+        if((ordered != reference) || (unordered.size() != reference.size()))
+        {
+            cerr << "Output mismatch with " << threads << " threads!" << endl;
+            return 1;
+        }
+
+        cout << setw(8)  << threads
+             << setw(14) << orderedTime     << setw(10) << setprecision(2) << sequential / orderedTime   << setprecision(4)
+             << setw(14) << unorderedTime   << setw(10) << setprecision(2) << sequential / unorderedTime << setprecision(4)
+             << setw(12) << listTime        << setw(10) << setprecision(2) << sequential / listTime      << setprecision(4)
+             << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,74 @@
+/** @file       ParallelSelection.h
+ *  @details    Multi-threaded top-k selection over an Array.
+ *              Each worker selects the k smallest elements of its own slice with a bounded heap,
+ *              the calling thread then selects the final k out of the candidates of all workers.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Link with -pthread.
+ *  @note       The single threaded selections are Array::TopK, Array::PartialSort and Array::NthElement.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef PARALLEL_SELECTION_H
+#define PARALLEL_SELECTION_H
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "ArrayContainer.h"
+#include "ParallelFunction.h"
+
+/**
+ * @brief   Copies the k smallest elements of an array into a new array, in ascending order, by using multiple threads.
+ * @param   array       Source array, only read.
+ * @param   k           Number of elements to be selected, all elements are copied if k is not less than the size.
+ * @param   compare     Strict weak ordering, must be safe to call concurrently. std::greater selects the largest ones.
+ * @param   threadCount Worker count, zero selects the hardware concurrency.
+ * @return  Array of min(k, array.getSize()) elements, the same elements Array::TopK selects.
+ * @throws  std::logic_error If k or the size of the array is zero.
+ * @note    The workers read disjoint slices and write their own candidate buffers, so nothing is shared
+ *          but the source. Each buffer holds at most k elements, the final selection is over
+ *          workers * k candidates.
+ */
+template<class T, class Compare = std::less<T>>
+Array<T> ParallelTopK(const Array<T>& array, const size_t k, Compare compare = Compare(), const size_t threadCount = 0)
+{
+    const size_t size           = array.getSize();
+    const size_t selectedSize   = (k < size) ? k : size;
+    const size_t workerCount    = ParallelDetail::WorkerCount(threadCount, size);
+
+    Array<T> selected(selectedSize);    // Throws for a zero size, before any thread is started
+
+    if(workerCount == 1)
+    {
+        std::partial_sort_copy(array.begin(), array.end(), selected.begin(), selected.end(), compare);
+        return selected;
+    }
+
+    const size_t sliceSize = (size + workerCount - 1) / workerCount;
+    std::vector<std::vector<T>> candidates(workerCount);
+
+    ParallelDetail::RunOnWorkers(workerCount, [&](const size_t worker)
+    {
+        const T* const sliceBegin   = array.begin() + std::min(size, worker * sliceSize);
+        const T* const sliceEnd     = array.begin() + std::min(size, (worker + 1) * sliceSize);
+
+        std::vector<T>& buffer = candidates[worker];
+        buffer.resize(std::min<size_t>(selectedSize, sliceEnd - sliceBegin));
+        std::partial_sort_copy(sliceBegin, sliceEnd, buffer.begin(), buffer.end(), compare);
+    });
+
+    // The winners are among the winners of the slices
+    std::vector<T> merged;
+    for(std::vector<T>& buffer : candidates)
+        std::move(buffer.begin(), buffer.end(), std::back_inserter(merged));
+
+    std::partial_sort_copy(merged.begin(), merged.end(), selected.begin(), selected.end(), compare);
+
+    return selected;
+}
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,335 @@
+/** @file       PerfCounters.h
+ *  @details    Hardware performance counters around a measured region, read with Linux perf_event_open.
+ *              Cycles, instructions, L1 data cache misses, last level cache misses, branch misses and
+ *              data TLB misses are counted for the calling thread, in user space only.
+ *              Events which cannot be opened (no PMU in a virtual machine, perf_event_paranoid,
+ *              seccomp, non-Linux systems) are reported as unavailable and the region still runs.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Counters multiplexed by the kernel are scaled by the enabled and running times.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <array>
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <utility>
+#include <cstdint>
+#include <cstring>
+
+#include "Benchmark.h"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+namespace Benchmark {
+
+/**
+ * @brief   Counted hardware events.
+ */
+enum class PerfEvent{
+    Cycles = 0,
+    Instructions,
+    L1DataMisses,
+    LastLevelMisses,
+    BranchMisses,
+    DataTlbMisses,
+    Count   // Number of events, not an event
+};
+
+constexpr size_t perfEventCount = static_cast<size_t>(PerfEvent::Count);
+
+/**
+ * @brief   Short names used in reports, in the order of PerfEvent.
+ */
+inline const char* PerfEventName(const PerfEvent event)
+{
+    static const char* const names[perfEventCount] = {"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "dtlb_misses"};
+    return names[static_cast<size_t>(event)];
+}
+
+/**
+ * @brief   Counter values of a measured region.
+ */
+struct PerfCounterValues{
+    std::array<uint64_t, perfEventCount> values{};  // Scaled counts, zero if unavailable
+    std::array<bool, perfEventCount> available{};   // Whether the event could be counted
+
+    uint64_t Get(const PerfEvent event) const       { return values[static_cast<size_t>(event)];    }
+    bool IsAvailable(const PerfEvent event) const   { return available[static_cast<size_t>(event)]; }
+
+    double InstructionsPerCycle() const
+    {
+        return (IsAvailable(PerfEvent::Cycles) && IsAvailable(PerfEvent::Instructions) && (Get(PerfEvent::Cycles) != 0))
+             ? static_cast<double>(Get(PerfEvent::Instructions)) / Get(PerfEvent::Cycles) : 0;
+    }
+
+    std::string ToText(const size_t elements = 0) const;    // Counts, or counts per element if elements is given
+};
+
+/**
+ * @brief   Formats the available counters as key=value pairs.
+ * @param   elements    Divides the counts when non-zero, to compare different sizes.
+ * @return  Text of the form "cycles=... instructions=... ipc=...", or "counters=unavailable".
+ */
+inline std::string PerfCounterValues::ToText(const size_t elements) const
+{
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(elements != 0 ? 3 : 0);
+
+    for(size_t index = 0; index < perfEventCount; index++)
+    {
+        if(available[index] == false)
+            continue;
+
+        text << ((text.tellp() == 0) ? "" : " ") << PerfEventName(static_cast<PerfEvent>(index)) << "=";
+
+        if(elements != 0)
+            text << static_cast<double>(values[index]) / elements;
+        else
+            text << values[index];
+    }
+
+    if(text.tellp() == 0)
+        return "counters=unavailable";
+
+    if(InstructionsPerCycle() != 0)
+        text << " ipc=" << std::setprecision(2) << InstructionsPerCycle();
+
+    return text.str();
+}
+
+/**
+ * @brief   Set of per-thread hardware counters, opened once and reused for many regions.
+ * @note    Each event is opened on its own, so a missing event does not disable the others.
+ */
+class PerfCounters{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool IsAvailable() const;                               // True if at least one event could be opened
+    const std::string& GetUnavailableReason() const { return reason; }
+
+    void Start();                   // Resets and enables the counters
+    PerfCounterValues Stop();       // Disables the counters and reads them
+
+    template<class CallableType>
+    PerfCounterValues Measure(CallableType callable)    // Counts the events of a single call
+    {
+        Start();
+        callable();
+        return Stop();
+    }
+
+private:
+    std::array<int, perfEventCount> descriptors;    // -1 for unavailable events
+    std::string reason;                             // Error of the first event which failed to open
+};
+
+#if defined(__linux__)
+
+/**
+ * @brief   Opens the counters of the calling thread, disabled.
+ */
+inline PerfCounters::PerfCounters()
+{
+    descriptors.fill(-1);
+
+    auto cacheConfig = [](const uint64_t cache, const uint64_t operation, const uint64_t result)
+    { return cache | (operation << 8) | (result << 16); };
+
+    const std::pair<uint32_t, uint64_t> configs[perfEventCount] = {
+        {PERF_TYPE_HARDWARE,    PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE,    PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE,    cacheConfig(PERF_COUNT_HW_CACHE_L1D,  PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+        {PERF_TYPE_HARDWARE,    PERF_COUNT_HW_CACHE_MISSES},
+        {PERF_TYPE_HARDWARE,    PERF_COUNT_HW_BRANCH_MISSES},
+        {PERF_TYPE_HW_CACHE,    cacheConfig(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+    };
+
+    for(size_t index = 0; index < perfEventCount; index++)
+    {
+        perf_event_attr attributes;
+        std::memset(&attributes, 0, sizeof(attributes));
+
+        attributes.size             = sizeof(attributes);
+        attributes.type             = configs[index].first;
+        attributes.config           = configs[index].second;
+        attributes.disabled         = 1;
+        attributes.exclude_kernel   = 1;    // Allowed with perf_event_paranoid up to 2
+        attributes.exclude_hv       = 1;
+        attributes.read_format      = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const long descriptor = syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+
+        if(descriptor >= 0)
+            descriptors[index] = static_cast<int>(descriptor);
+        else if(reason.empty() == true)
+            reason = std::string(PerfEventName(static_cast<PerfEvent>(index))) + ": " + std::strerror(errno);
+        else;
+    }
+}
+
+/**
+ * @brief   Closes the counters.
+ */
+inline PerfCounters::~PerfCounters()
+{
+    for(const int descriptor : descriptors)
+        if(descriptor >= 0)
+            close(descriptor);
+}
+
+/**
+ * @brief   Resets and enables all open counters.
+ */
+inline void PerfCounters::Start()
+{
+    for(const int descriptor : descriptors)
+        if(descriptor >= 0)
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+
+    for(const int descriptor : descriptors)
+        if(descriptor >= 0)
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+/**
+ * @brief   Disables all open counters and reads them.
+ * @return  Counter values, scaled if the kernel multiplexed the counters.
+ */
+inline PerfCounterValues PerfCounters::Stop()
+{
+    for(const int descriptor : descriptors)
+        if(descriptor >= 0)
+            ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+
+    PerfCounterValues result;
+
+    for(size_t index = 0; index < perfEventCount; index++)
+    {
+        uint64_t data[3] = {0, 0, 0};   // Value, time enabled, time running
+
+        if((descriptors[index] < 0) || (read(descriptors[index], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))))
+            continue;
+
+        if(data[2] == 0)    // Never scheduled on the PMU
+            continue;
+
+        result.available[index] = true;
+        result.values[index]    = (data[2] < data[1])
+                                ? static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2])
+                                : data[0];
+    }
+
+    return result;
+}
+
+#else
+
+inline PerfCounters::PerfCounters() : reason("perf_event_open is available on Linux only")
+{ descriptors.fill(-1); }
+
+inline PerfCounters::~PerfCounters()            { /* Nothing to close */ }
+inline void PerfCounters::Start()               { /* Nothing to start */ }
+inline PerfCounterValues PerfCounters::Stop()   { return PerfCounterValues(); }
+
+#endif
+
+/**
+ * @brief   Checks whether any of the events can be counted.
+ * @return  True if at least one counter is open.
+ */
+inline bool PerfCounters::IsAvailable() const
+{
+    for(const int descriptor : descriptors)
+        if(descriptor >= 0)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief   Duration and counters of the fastest run.
+ */
+struct CountedMeasurement{
+    double seconds = 0;
+    PerfCounterValues counters;
+};
+
+/**
+ * @brief   Runs the callable several times after an untimed setup, counting the events of each run.
+ * @param   counters    Open counters, see PerfCounters.
+ * @param   repetitions Number of measured runs, at least one run is made.
+ * @param   setup       Preparation before each run, not counted.
+ * @param   callable    Work to be measured.
+ * @return  Duration and counters of the fastest run.
+ */
+template<class SetupType, class CallableType>
+CountedMeasurement MeasureBestCounted(PerfCounters& counters, const size_t repetitions, SetupType setup, CallableType callable)
+{
+    CountedMeasurement best;
+
+    for(size_t run = 0; (run < repetitions) || (run == 0); run++)
+    {
+        setup();
+
+        Stopwatch watch;
+        counters.Start();
+        callable();
+        const PerfCounterValues values = counters.Stop();
+        const double elapsed = watch.ElapsedSeconds();
+
+        if((run == 0) || (elapsed < best.seconds))
+        {
+            best.seconds    = elapsed;
+            best.counters   = values;
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief   Runs the callable several times, counting the events of each run.
+ * @param   counters    Open counters, see PerfCounters.
+ * @param   repetitions Number of measured runs, at least one run is made.
+ * @param   callable    Work to be measured.
+ * @return  Duration and counters of the fastest run.
+ */
+template<class CallableType>
+CountedMeasurement MeasureBestCounted(PerfCounters& counters, const size_t repetitions, CallableType callable)
+{
+    return MeasureBestCounted(counters, repetitions, []() { /* No setup */ }, callable);
+}
+
+/**
+ * @brief   Copies the available counters into a result, so they are written into the JSON log.
+ * @param   result      Destination result.
+ * @param   counters    Counter values of the measured region.
+ */
+inline void AttachCounters(Result& result, const PerfCounterValues& counters)
+{
+    for(size_t index = 0; index < perfEventCount; index++)
+        if(counters.available[index] == true)
+            result.counters.emplace_back(PerfEventName(static_cast<PerfEvent>(index)), counters.values[index]);
+}
+
+} // namespace Benchmark
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,121 @@
+// Description: Wall-clock time and hardware counters of List and Array operations against std:: containers
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 PerfCountersBenchmark.cpp -o PerfCountersBenchmark
+// Usage:       ./PerfCountersBenchmark [outputPath] [label]
+//              (defaults: PerfCountersBenchmark.json and an empty label)
+//              Counters need a PMU and perf_event_paranoid <= 2, timings are reported regardless.
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <list>
+#include <optional>
+#include <algorithm>
+#include <random>
+#include <numeric>
+
+#include "Benchmark.h"
+#include "PerfCounters.h"
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+
+using namespace std;
+
+static const size_t repetitions = 5;
+
+// Stores the result and prints the time and the counters per element
+static void Record(Benchmark::ResultLog& log, const string& operation, const string& container,
+                   const size_t size, const Benchmark::CountedMeasurement& measurement)
+{
+    Benchmark::Result result;
+    result.operation    = operation;
+    result.container    = container;
+    result.elementType  = "int";
+    result.size         = size;
+    result.seconds      = measurement.seconds;
+    Benchmark::AttachCounters(result, measurement.counters);
+    log.Add(result);
+
+    cout << setw(10) << left << operation << setw(12) << container << right << setw(9) << size
+         << setw(11) << fixed << setprecision(2) << result.NanosecondsPerElement() << " ns/elem  "
+         << measurement.counters.ToText(size) << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const string path   = (argc > 1) ? argv[1] : "PerfCountersBenchmark.json";
+    const string label  = (argc > 2) ? argv[2] : "";
+
+    Benchmark::PerfCounters counters;
+    if(counters.IsAvailable() == false)
+        cout << "Hardware counters unavailable (" << counters.GetUnavailableReason() << "), timings only" << endl;
+
+    Benchmark::ResultLog log("PerfCountersBenchmark", label);
+
+    // Linear search, the key is the last element. List exposes its search through the replace methods.
+    for(const size_t size : {1ul << 12, 1ul << 16, 1ul << 20})
+    {
+        vector<int> values(size);
+        iota(values.begin(), values.end(), 0);
+        const int key = values.back();
+
+        List<int> ownList(values.begin(), values.end());
+        list<int> stdList(values.begin(), values.end());
+
+        Record(log, "find", "List", size, Benchmark::MeasureBestCounted(counters, repetitions, [&]()
+        {
+            ownList.ReplaceFirstWith(key, key);
+        }));
+        Record(log, "find", "std::list", size, Benchmark::MeasureBestCounted(counters, repetitions, [&]()
+        {
+            Benchmark::DoNotOptimize(*find(stdList.begin(), stdList.end(), key));
+        }));
+
+        const Array<int> leftArray(values.begin(), values.end()), rightArray(values.begin(), values.end());
+        const vector<int> leftVector(values), rightVector(values);
+
+        Record(log, "equality", "Array", size, Benchmark::MeasureBestCounted(counters, repetitions, [&]()
+        {
+            Benchmark::DoNotOptimize(leftArray == rightArray);
+        }));
+        Record(log, "equality", "std::vector", size, Benchmark::MeasureBestCounted(counters, repetitions, [&]()
+        {
+            Benchmark::DoNotOptimize(leftVector == rightVector);
+        }));
+    }
+
+    // List::Sort is a selection sort, so it is measured on smaller inputs
+    for(const size_t size : {1ul << 8, 1ul << 10, 1ul << 12})
+    {
+        vector<int> values(size);
+        iota(values.begin(), values.end(), 0);
+        shuffle(values.begin(), values.end(), mt19937(7));
+
+        optional<List<int>> ownList;
+        optional<list<int>> stdList;
+
+        Record(log, "sort", "List", size, Benchmark::MeasureBestCounted(counters, repetitions,
+            [&]() { ownList.emplace(values.begin(), values.end()); },
+            [&]() { ownList->Sort(); }));
+        Record(log, "sort", "std::list", size, Benchmark::MeasureBestCounted(counters, repetitions,
+            [&]() { stdList.emplace(values.begin(), values.end()); },
+            [&]() { stdList->sort(); }));
+    }
+
+    ofstream file(path);
+    log.WriteJson(file);
+
+    if(!file)
+    {
+        cerr << "Results cannot be written to " << path << endl;
+        return 1;
+    }
+
+    cout << log.GetResults().size() << " results written to " << path << endl;
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Description: Iteration and erase cost of SlotMap against List for entity records
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 SlotMapBenchmark.cpp -o SlotMapBenchmark
+// Usage:       ./SlotMapBenchmark [entities]
+//              (default: 1000000)
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <optional>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "ListContainer.h"
+#include "SlotMapContainer.h"
+
+using namespace std;
+
+static const size_t repetitions = 5;
+
+// Typical entity record, 32 bytes
+struct Entity{
+    uint64_t id = 0;
+    double x = 0, y = 0, z = 0;
+
+    bool operator==(const Entity& anotherEntity) const { return (id == anotherEntity.id); }
+    bool operator<(const Entity& anotherEntity) const { return (id < anotherEntity.id); }
+};
+
+static Entity MakeEntity(const uint64_t id)
+{
+    Entity entity;
+    entity.id   = id;
+    entity.x    = id * 0.5;
+    entity.y    = id * 0.25;
+    entity.z    = id * 0.125;
+    return entity;
+}
+
+static void PrintRow(const char* operation, const char* container, const size_t count, const double seconds)
+{
+    cout << setw(12) << left << operation << setw(10) << container << right
+         << setw(10) << count << setw(12) << fixed << setprecision(2) << seconds * 1e9 / count << " ns/elem" << endl;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t entities = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+    mt19937_64 generator(3);
+
+    // A tenth of the entities, in random order, is erased by both containers
+    vector<uint64_t> victims;
+    for(uint64_t id = 0; id < entities; id += 10)
+        victims.push_back(id);
+    shuffle(victims.begin(), victims.end(), generator);
+
+    optional<List<Entity>> list;
+    optional<SlotMap<Entity>> slots;
+    vector<SlotHandle> handles(entities);
+
+    // Fill in interleaved order with some churn, so the list nodes are scattered in the heap like long lived records
+    auto buildList = [&]()
+    {
+        list.emplace();
+        for(uint64_t id = 0; id < entities; id++)
+            ((id % 2 == 0) ? list->Append(MakeEntity(id)) : list->Prepend(MakeEntity(id)));
+    };
+
+    auto buildSlots = [&]()
+    {
+        slots.emplace();
+        for(uint64_t id = 0; id < entities; id++)
+            handles[id] = slots->Insert(MakeEntity(id));
+    };
+
+    buildList();
+    buildSlots();
+
+    PrintRow("iterate", "List", entities, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        double sum = 0;
+        auto it = list->begin();
+
+        for(size_t index = 0; index < list->GetNodeCount(); index++, it++)
+            sum += (*it).x + (*it).y + (*it).z;
+
+        Benchmark::DoNotOptimize(sum);
+    }));
+
+    PrintRow("iterate", "SlotMap", entities, Benchmark::MeasureBest(repetitions, [&]()
+    {
+        double sum = 0;
+
+        for(const Entity& entity : *slots)
+            sum += entity.x + entity.y + entity.z;
+
+        Benchmark::DoNotOptimize(sum);
+    }));
+
+    // List has no handle, a record is erased by its value, each one is a linear search
+    const size_t listVictims = min<size_t>(victims.size(), 100);
+
+    PrintRow("erase", "List", listVictims, Benchmark::MeasureBest(1, buildList, [&]()
+    {
+        for(size_t index = 0; index < listVictims; index++)
+            list->RemoveFirstOf(MakeEntity(victims[index]));
+    }));
+
+    PrintRow("erase", "SlotMap", victims.size(), Benchmark::MeasureBest(repetitions, buildSlots, [&]()
+    {
+        for(const uint64_t id : victims)
+            slots->Erase(handles[id]);
+    }));
+
+    // Bulk erase, a single pass over the list against erasing through the handles
+    PrintRow("erase_all10", "List", victims.size(), Benchmark::MeasureBest(repetitions, buildList, [&]()
+    {
+        list->RemoveIf([](const Entity& entity) { return (entity.id % 10) == 0; });
+    }));
+
+    // Stale handles are detected after the erase
+    size_t stale = 0;
+    for(const uint64_t id : victims)
+        stale += (slots->Contains(handles[id]) == false) ? 1 : 0;
+
+    cout << stale << " of " << victims.size() << " erased handles detected as stale, "
+         << slots->getSize() << " entities left" << endl;
+
+    return 0;
+}
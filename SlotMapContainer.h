@@ -0,0 +1,473 @@
+/** @file       SlotMapContainer.h
+ *  @details    A template slot map: dense storage addressed by generational handles.
+ *              The elements are packed at the front of an Array, so iterating over them is a linear
+ *              scan. A handle names a slot rather than an element position; the slot records where
+ *              its element currently lives, so erasing by moving the last element into the gap keeps
+ *              every other handle valid. Each slot carries a generation which changes whenever its
+ *              element is erased, so a handle kept after the erase is detected as stale instead of
+ *              silently reaching another element.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       The buffers are Array instances, so the element type must be default constructible and assignable.
+ *  @note       Element addresses change on erase and growth, keep handles rather than pointers.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef SLOT_MAP_CONTAINER_H
+#define SLOT_MAP_CONTAINER_H
+
+#include <string>
+#include <utility>
+#include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+
+#include "ArrayContainer.h"
+
+/**
+ * @brief   64 bit handle of a slot map element: the slot index and the generation of the slot.
+ * @note    A default constructed handle is null, it never refers to an element.
+ */
+class SlotHandle{
+public:
+    SlotHandle() = default;
+    SlotHandle(const uint32_t index, const uint32_t generation)
+    : value((static_cast<uint64_t>(generation) << 32) | index)
+    { /* Empty constructor */ }
+
+    uint32_t GetIndex() const       { return static_cast<uint32_t>(value);          }
+    uint32_t GetGeneration() const  { return static_cast<uint32_t>(value >> 32);    }
+    uint64_t GetValue() const       { return value;                                 }   // Packed form, e.g. to be stored elsewhere
+    bool isNull() const             { return (value == 0);                          }
+
+    static SlotHandle FromValue(const uint64_t value) { SlotHandle handle; handle.value = value; return handle; }
+
+    bool operator==(const SlotHandle& anotherHandle) const { return (value == anotherHandle.value); }
+    bool operator!=(const SlotHandle& anotherHandle) const { return (value != anotherHandle.value); }
+
+private:
+    uint64_t value = 0;     // Generation in the upper half, index in the lower half
+};
+
+template<class T>
+class SlotMap{
+public:
+    /*** Constructors and Destructors ***/
+    SlotMap();                                  // Default constructor
+    SlotMap(const SlotMap<T>& anotherMap);      // Copy constructor, the handles of the source stay valid on the copy
+    SlotMap(SlotMap<T>&& anotherMap);           // Move constructor
+
+    virtual ~SlotMap();     // Destructor
+
+    const SlotMap<T>& operator=(const SlotMap<T>& rightMap);   // Slot map assignment
+
+    /*** Modifiers ***/
+    SlotHandle Insert(const T& data);           // Adds an element, returns its handle
+
+    template<class... Args>
+    SlotHandle Emplace(Args&&... args);         // Constructs the element from the arguments
+
+    bool Erase(const SlotHandle handle);        // Removes the element, the last element fills its place
+    void EraseAll();                            // Removes all elements, every handle becomes stale
+    void Reserve(const size_t capacity);        // Makes room for the given number of elements
+    void Swap(SlotMap<T>& anotherMap);          // Exchanges the content of two slot maps
+
+    /*** Element Access ***/
+    T* Get(const SlotHandle handle);            // Address of the element, nullptr if the handle is stale
+    const T* Get(const SlotHandle handle) const;
+    T& At(const SlotHandle handle);             // Element of the handle, throws if the handle is stale
+    const T& At(const SlotHandle handle) const;
+    bool Contains(const SlotHandle handle) const { return (Get(handle) != nullptr); }
+
+    SlotHandle GetHandle(const size_t position) const;     // Handle of the element at a dense position
+
+    /*** Status Checkers ***/
+    bool isEmpty() const            { return (count == 0);  }
+    size_t getSize() const          { return count;         }
+    size_t GetCapacity() const      { return (values == nullptr) ? 0 : values->getSize(); }
+
+    /*** Iterators ***/
+    // Raw pointers are used as iterators since the elements are dense, the order changes on erase
+    T* begin()              { return (values == nullptr) ? nullptr : values->begin();           }
+    T* end()                { return (values == nullptr) ? nullptr : values->begin() + count;   }
+    const T* begin() const  { return (values == nullptr) ? nullptr : values->begin();           }
+    const T* end() const    { return (values == nullptr) ? nullptr : values->begin() + count;   }
+
+private:
+    struct Slot{
+        uint32_t position   = 0;    // Dense position of the element, or the next free slot if the slot is free
+        uint32_t generation = 0;    // Odd while the slot holds an element
+    };
+
+    static constexpr uint32_t noSlot = UINT32_MAX;  // End of the free slot chain
+
+    Slot* FindSlot(const SlotHandle handle) const;  // Slot of a live handle, nullptr if stale
+    uint32_t AcquireSlot();                         // Pops a free slot or opens a new one
+    void Reallocate(const size_t capacity);         // Moves the elements into buffers of the given capacity
+
+    Array<T>* values            = nullptr;  // Dense elements, the first count are in use
+    Array<uint32_t>* owners     = nullptr;  // Slot index of each dense element
+    Array<Slot>* slots          = nullptr;  // Indirection from the handles to the dense positions
+    size_t count                = 0;        // Number of elements
+    uint32_t slotCount          = 0;        // Slots opened so far, free or not
+    uint32_t freeSlot           = noSlot;   // First free slot
+};
+
+
+/**
+ * @brief   Default constructor, no buffer is allocated until the first insertion.
+ */
+template<class T>
+SlotMap<T>::SlotMap()
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Copy constructor, the slots are copied as well so that the handles of the source work on the copy.
+ * @param   anotherMap  Source slot map
+ */
+template<class T>
+SlotMap<T>::SlotMap(const SlotMap<T>& anotherMap)
+{
+    if(anotherMap.values == nullptr)
+        return;
+
+    try
+    {
+        values  = new Array<T>(*anotherMap.values);
+        owners  = new Array<uint32_t>(*anotherMap.owners);
+        slots   = (anotherMap.slots == nullptr) ? nullptr : new Array<Slot>(*anotherMap.slots);     // No slot before the first insertion
+    }
+    catch(...)
+    {
+        delete values;
+        delete owners;
+        throw;
+    }
+
+    count       = anotherMap.count;
+    slotCount   = anotherMap.slotCount;
+    freeSlot    = anotherMap.freeSlot;
+}
+
+/**
+ * @brief   Move constructor, takes over the buffers of the source slot map.
+ * @param   anotherMap  Source slot map, left empty
+ */
+template<class T>
+SlotMap<T>::SlotMap(SlotMap<T>&& anotherMap)
+{
+    Swap(anotherMap);
+}
+
+/**
+ * @brief   Destructor
+ */
+template<class T>
+SlotMap<T>::~SlotMap()
+{
+    delete values;
+    delete owners;
+    delete slots;
+}
+
+/**
+ * @brief   Replaces the content by a copy of another slot map.
+ * @param   rightMap    Source slot map
+ * @return  rValue reference to the current slot map to support cascaded assignments
+ */
+template<class T>
+const SlotMap<T>& SlotMap<T>::operator=(const SlotMap<T>& rightMap)
+{
+    if(this != &rightMap)
+    {
+        SlotMap<T> copy(rightMap);
+        Swap(copy);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Adds a copy of the data.
+ * @param   data    Element to be added
+ * @return  Handle of the new element.
+ */
+template<class T>
+SlotHandle SlotMap<T>::Insert(const T& data)
+{
+    return Emplace(data);
+}
+
+/**
+ * @brief   Adds an element after the last dense one.
+ * @param   args    Arguments passed to the constructor of the element
+ * @return  Handle of the new element.
+ * @throws  std::length_error If all 2^32 - 1 slots are in use
+ */
+template<class T>
+template<class... Args>
+SlotHandle SlotMap<T>::Emplace(Args&&... args)
+{
+    T data(std::forward<Args>(args)...);    // Constructed first, so a throwing constructor leaves the map untouched
+
+    if(count == GetCapacity())
+        Reallocate((count < 8) ? 16 : count * 2);
+
+    const uint32_t index = AcquireSlot();
+    Slot& slot = slots->begin()[index];
+
+    values->begin()[count]  = std::move(data);
+    owners->begin()[count]  = index;
+    slot.position           = static_cast<uint32_t>(count);
+    slot.generation++;      // Becomes odd, the slot is live
+    count++;
+
+    return SlotHandle(index, slot.generation);
+}
+
+/**
+ * @brief   Removes the element of a handle, the last dense element is moved into its place.
+ * @param   handle  Handle of the element
+ * @return  true If the handle was live and its element is removed, false if it was stale.
+ * @note    A slot whose generation would wrap around is retired instead of being reused,
+ *          so an old handle can never become valid again.
+ */
+template<class T>
+bool SlotMap<T>::Erase(const SlotHandle handle)
+{
+    Slot* const slot = FindSlot(handle);
+    if(slot == nullptr)
+        return false;
+
+    const size_t position   = slot->position;
+    const size_t last       = count - 1;
+
+    if(position != last)
+    {
+        values->begin()[position]   = std::move(values->begin()[last]);
+        owners->begin()[position]   = owners->begin()[last];
+        slots->begin()[owners->begin()[position]].position = static_cast<uint32_t>(position);
+    }
+
+    values->begin()[last] = T();    // Releases the resources of the vacated element
+    count--;
+
+    slot->generation++;     // Becomes even, every handle of the slot is stale now
+
+    if(slot->generation != 0)
+    {
+        slot->position  = freeSlot;
+        freeSlot        = handle.GetIndex();
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Removes all elements, the buffers are kept.
+ * @note    The generations of the live slots advance, so all handles given so far become stale.
+ */
+template<class T>
+void SlotMap<T>::EraseAll()
+{
+    while(count > 0)
+        Erase(GetHandle(count - 1));
+}
+
+/**
+ * @brief   Grows the buffers so that the given number of elements fits without a reallocation.
+ * @param   capacity    Number of elements
+ */
+template<class T>
+void SlotMap<T>::Reserve(const size_t capacity)
+{
+    if(capacity > GetCapacity())
+        Reallocate(capacity);
+}
+
+/**
+ * @brief   Exchanges the content of two slot maps, no element is copied.
+ * @param   anotherMap  Slot map to be swapped with
+ */
+template<class T>
+void SlotMap<T>::Swap(SlotMap<T>& anotherMap)
+{
+    std::swap(values,       anotherMap.values);
+    std::swap(owners,       anotherMap.owners);
+    std::swap(slots,        anotherMap.slots);
+    std::swap(count,        anotherMap.count);
+    std::swap(slotCount,    anotherMap.slotCount);
+    std::swap(freeSlot,     anotherMap.freeSlot);
+}
+
+/**
+ * @brief   Reaches the element of a handle.
+ * @param   handle  Handle of the element
+ * @return  Address of the element, nullptr if the handle is null or stale.
+ */
+template<class T>
+T* SlotMap<T>::Get(const SlotHandle handle)
+{
+    const Slot* const slot = FindSlot(handle);
+    return (slot == nullptr) ? nullptr : (values->begin() + slot->position);
+}
+
+/**
+ * @brief   Reaches the element of a handle.
+ * @param   handle  Handle of the element
+ * @return  Address of the element, nullptr if the handle is null or stale.
+ */
+template<class T>
+const T* SlotMap<T>::Get(const SlotHandle handle) const
+{
+    const Slot* const slot = FindSlot(handle);
+    return (slot == nullptr) ? nullptr : (values->begin() + slot->position);
+}
+
+/**
+ * @brief   Reaches the element of a handle.
+ * @param   handle  Handle of the element
+ * @return  lValue reference to the element.
+ * @throws  std::logic_error If the handle is null or stale
+ */
+template<class T>
+T& SlotMap<T>::At(const SlotHandle handle)
+{
+    T* const element = Get(handle);
+
+    if(element == nullptr)
+        throw std::logic_error("Stale slot map handle!");
+
+    return *element;
+}
+
+/**
+ * @brief   Reaches the element of a handle.
+ * @param   handle  Handle of the element
+ * @return  rValue reference to the element.
+ * @throws  std::logic_error If the handle is null or stale
+ */
+template<class T>
+const T& SlotMap<T>::At(const SlotHandle handle) const
+{
+    const T* const element = Get(handle);
+
+    if(element == nullptr)
+        throw std::logic_error("Stale slot map handle!");
+
+    return *element;
+}
+
+/**
+ * @brief   Builds the handle of a dense element, e.g. while iterating.
+ * @param   position    Index of the element from begin()
+ * @return  Handle of the element.
+ * @throws  std::range_error When the position is out of range
+ */
+template<class T>
+SlotHandle SlotMap<T>::GetHandle(const size_t position) const
+{
+    if(position >= count)
+    {
+        std::string errorMessage = "Out-of-Range Exception Occured ";
+                    errorMessage += "(Size = "      + std::to_string(count)     + ") ";
+                    errorMessage += "(Position = "  + std::to_string(position)  + ") ";
+        throw std::range_error(errorMessage);
+    }
+
+    const uint32_t index = owners->begin()[position];
+    return SlotHandle(index, slots->begin()[index].generation);
+}
+
+/**
+ * @brief   Validates a handle.
+ * @param   handle  Handle to be checked
+ * @return  Slot of the handle, nullptr if the slot is out of range, free or of another generation.
+ */
+template<class T>
+typename SlotMap<T>::Slot* SlotMap<T>::FindSlot(const SlotHandle handle) const
+{
+    const uint32_t index = handle.GetIndex();
+
+    if(index >= slotCount)
+        return nullptr;
+
+    Slot* const slot = slots->begin() + index;
+
+    // A free or retired slot has an even generation, the null handle and forged handles may carry one too
+    if((slot->generation & 1) == 0)
+        return nullptr;
+
+    return (slot->generation == handle.GetGeneration()) ? slot : nullptr;
+}
+
+/**
+ * @brief   Provides a slot for a new element.
+ * @return  Index of a free slot.
+ * @throws  std::length_error If all 2^32 - 1 slots are in use
+ * @note    The slot array grows on its own, retired slots can make it longer than the dense arrays.
+ */
+template<class T>
+uint32_t SlotMap<T>::AcquireSlot()
+{
+    if(freeSlot != noSlot)
+    {
+        const uint32_t index = freeSlot;
+        freeSlot = slots->begin()[index].position;
+        return index;
+    }
+
+    if(slotCount == noSlot)
+        throw std::length_error("Slot map is out of slots!");
+
+    if((slots == nullptr) || (slotCount == slots->getSize()))
+    {
+        Array<Slot>* const newSlots = new Array<Slot>((slotCount < 8) ? 16 : static_cast<size_t>(slotCount) * 2);
+
+        for(uint32_t index = 0; index < slotCount; index++)
+            newSlots->begin()[index] = slots->begin()[index];
+
+        delete slots;
+        slots = newSlots;
+    }
+
+    return slotCount++;
+}
+
+/**
+ * @brief   Moves the elements into new buffers.
+ * @param   capacity    Number of elements of the new buffers, not less than the element count
+ * @note    The slots don't move, the handles stay valid.
+ */
+template<class T>
+void SlotMap<T>::Reallocate(const size_t capacity)
+{
+    Array<T>* newValues         = new Array<T>(capacity);
+    Array<uint32_t>* newOwners  = nullptr;
+
+    try
+    {
+        newOwners = new Array<uint32_t>(capacity);
+    }
+    catch(...)
+    {
+        delete newValues;
+        throw;
+    }
+
+    for(size_t position = 0; position < count; position++)
+    {
+        newValues->begin()[position] = std::move(values->begin()[position]);
+        newOwners->begin()[position] = owners->begin()[position];
+    }
+
+    delete values;
+    delete owners;
+
+    values = newValues;
+    owners = newOwners;
+}
+
+#endif  // Prevent recursive inclusion
@@ -0,0 +1,737 @@
+/** @file       SortedArrayKernels.h
+ *  @details    Intersection, union and difference kernels for sorted integer arrays, e.g. the posting lists
+ *              of an inverted index. The results are written into a preallocated output Array.
+ *              Intersection and difference compare whole blocks at once: 4x4 elements with SSE2,
+ *              8x8 elements with AVX2, every element of a block against every element of the other one.
+ *              Matches are packed with a shuffle table (SSSE3 or AVX2) instead of one branch per element.
+ *              Union merges blocks of 4 with a merging network and drops the repeated elements while
+ *              storing (SSE4.1). When one array is much longer than the other, the short one gallops
+ *              through the long one. The scalar intersection and difference merges are branch-free.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       The inputs must be sorted in ascending order without duplicates, this is not checked.
+ *  @note       The kernels store whole vectors and write one slot per step, also for elements which are dropped.
+ *              So the output must be sized for the whole input, and the slots past the result are overwritten.
+ *  @note       The block kernels are used for 32-bit integers, the instruction set is chosen at compile time
+ *              (e.g. -msse4.1, -mavx2 or -march=native). Other integer types use the scalar kernels.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef SORTED_ARRAY_KERNELS_H
+#define SORTED_ARRAY_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+#include <functional>
+#include <type_traits>
+
+#include "ArrayContainer.h"
+#include "FlatMapContainer.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
+#if defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace SortedKernels {
+
+// Size ratio from which the shorter array gallops through the longer one instead of a merge
+static const size_t gallopRatio = 32;
+
+// Block compares are done for 32-bit integers
+template<class T>
+constexpr bool isBlockLane = std::is_integral<T>::value && (sizeof(T) == 4);
+
+/**
+ * @brief   Lane selections packing the marked elements of a block to its front, indexed by the mark bits.
+ */
+struct PackTables{
+    alignas(16) uint8_t bytes[16][16]   = {};   // Byte indices of _mm_shuffle_epi8, 4 lanes
+    alignas(32) uint32_t lanes[256][8]  = {};   // Lane indices of _mm256_permutevar8x32_epi32, 8 lanes
+
+    constexpr PackTables()
+    {
+        for(unsigned mask = 0; mask < 16; mask++)
+        {
+            unsigned packed = 0;
+            for(unsigned lane = 0; lane < 4; lane++)
+                if(((mask >> lane) & 1) != 0)
+                {
+                    for(unsigned byte = 0; byte < 4; byte++)
+                        bytes[mask][packed * 4 + byte] = static_cast<uint8_t>(lane * 4 + byte);
+
+                    packed++;
+                }
+        }
+
+        for(unsigned mask = 0; mask < 256; mask++)
+        {
+            unsigned packed = 0;
+            for(unsigned lane = 0; lane < 8; lane++)
+                if(((mask >> lane) & 1) != 0)
+                    lanes[mask][packed++] = lane;
+        }
+    }
+};
+
+inline constexpr PackTables packTables{};
+
+/**
+ * @brief   Index of the first element not less than the key, searched from a position onwards.
+ * @param   data        Sorted elements
+ * @param   position    Search start, the elements before it are less than the key.
+ * @param   size        Number of elements
+ * @param   key         Search key
+ * @return  Index in [position, size].
+ * @note    The step doubles until the key is passed, so the cost is logarithmic in the distance, not in the size.
+ */
+template<class T>
+inline size_t GallopLowerBound(const T* data, const size_t position, const size_t size, const T key)
+{
+    if((position >= size) || (data[position] >= key))
+        return position;
+
+    size_t bound = 1;
+    while((position + bound < size) && (data[position + bound] < key))
+        bound *= 2;
+
+    // data[position + bound / 2] is less than the key, the answer lies after it and up to position + bound
+    const size_t low    = position + bound / 2 + 1;
+    const size_t high   = (position + bound < size) ? (position + bound + 1) : size;
+
+    return low + FlatLowerBound(data + low, high - low, key, std::less<T>());
+}
+
+/**
+ * @brief   Writes the marked elements of a block of 4, one by one.
+ * @return  Number of elements written.
+ * @note    Without any branch per element when there is room for the whole block.
+ */
+template<class T>
+inline size_t PackScalar(const T* block, const unsigned mask, const size_t lanes, T* output, const size_t room)
+{
+    size_t count = 0;
+
+    if(room >= lanes)   // Every element is written, only the marked ones move the position
+    {
+        for(size_t lane = 0; lane < lanes; lane++)
+        {
+            output[count]   = block[lane];
+            count          += (mask >> lane) & 1;
+        }
+    }
+    else
+    {
+        for(size_t lane = 0; lane < lanes; lane++)
+            if(((mask >> lane) & 1) != 0)
+                output[count++] = block[lane];
+    }
+
+    return count;
+}
+
+/**
+ * @brief   Branch-free merge intersection.
+ * @return  Number of common elements written into the output.
+ * @note    The output must hold min(firstSize, secondSize) elements.
+ */
+template<class T>
+size_t IntersectScalar(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    size_t i = 0, j = 0, count = 0;
+
+    while((i < firstSize) && (j < secondSize))
+    {
+        const T left = first[i], right = second[j];
+
+        output[count]   = left;     // Always below min(firstSize, secondSize), see the note
+        count          += (left == right) ? 1 : 0;
+        i              += (left <= right) ? 1 : 0;
+        j              += (right <= left) ? 1 : 0;
+    }
+
+    return count;
+}
+
+/**
+ * @brief   Intersection by searching each element of the short array in the long one.
+ * @return  Number of common elements written into the output.
+ */
+template<class T>
+size_t IntersectGalloping(const T* shorter, const size_t shorterSize, const T* longer, const size_t longerSize, T* output)
+{
+    size_t position = 0, count = 0;
+
+    for(size_t index = 0; (index < shorterSize) && (position < longerSize); index++)
+    {
+        position = GallopLowerBound(longer, position, longerSize, shorter[index]);
+
+        output[count]   = shorter[index];
+        count          += ((position < longerSize) && (longer[position] == shorter[index])) ? 1 : 0;
+    }
+
+    return count;
+}
+
+/**
+ * @brief   Branch-free merge difference, the first elements marked as already found are skipped.
+ * @param   found   Bit i is set if first[i] was found in the second array before, only the first 8 bits are used.
+ * @return  Number of elements of the first array written into the output.
+ */
+template<class T>
+size_t DifferenceScalar(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output,
+                        const unsigned found = 0)
+{
+    size_t i = 0, j = 0, count = 0;
+
+    auto isFound = [found](const size_t index) { return (index < 8) && (((found >> index) & 1) != 0); };
+
+    while((i < firstSize) && (j < secondSize))
+    {
+        const T left = first[i], right = second[j];
+
+        output[count]   = left;     // Below i + 1, so within firstSize
+        count          += ((left < right) && (isFound(i) == false)) ? 1 : 0;
+        i              += (left <= right) ? 1 : 0;
+        j              += (right <= left) ? 1 : 0;
+    }
+
+    for(; i < firstSize; i++)
+        if(isFound(i) == false)
+            output[count++] = first[i];
+
+    return count;
+}
+
+/**
+ * @brief   Difference by galloping, runs of the first array between the matches are copied at once.
+ * @return  Number of elements of the first array written into the output.
+ */
+template<class T>
+size_t DifferenceGalloping(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    size_t count = 0;
+
+    if(firstSize >= secondSize)     // Each removed element is searched in the first array
+    {
+        size_t position = 0;
+
+        for(size_t index = 0; (index < secondSize) && (position < firstSize); index++)
+        {
+            const size_t next = GallopLowerBound(first, position, firstSize, second[index]);
+
+            std::copy(first + position, first + position + (next - position), output + count);
+            count      += next - position;
+            position    = ((next < firstSize) && (first[next] == second[index])) ? (next + 1) : next;
+        }
+
+        std::copy(first + position, first + position + (firstSize - position), output + count);
+        count += firstSize - position;
+    }
+    else                            // Each kept element is searched in the second array
+    {
+        size_t position = 0;
+
+        for(size_t index = 0; index < firstSize; index++)
+        {
+            position = GallopLowerBound(second, position, secondSize, first[index]);
+
+            output[count]   = first[index];
+            count          += ((position < secondSize) && (second[position] == first[index])) ? 0 : 1;
+        }
+    }
+
+    return count;
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief   Marks the elements of a block of 4 found anywhere in another block of 4.
+ * @return  Bit i is set if first[i] is in the second block.
+ */
+inline unsigned MatchBlock4(const __m128i first, const __m128i second)
+{
+    __m128i match = _mm_cmpeq_epi32(first, second);
+
+    // The other three rotations of the second block cover all pairs
+    match = _mm_or_si128(match, _mm_cmpeq_epi32(first, _mm_shuffle_epi32(second, _MM_SHUFFLE(0, 3, 2, 1))));
+    match = _mm_or_si128(match, _mm_cmpeq_epi32(first, _mm_shuffle_epi32(second, _MM_SHUFFLE(1, 0, 3, 2))));
+    match = _mm_or_si128(match, _mm_cmpeq_epi32(first, _mm_shuffle_epi32(second, _MM_SHUFFLE(2, 1, 0, 3))));
+
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(match)));
+}
+
+/**
+ * @brief   Writes the marked elements of a block of 4.
+ * @return  Number of elements written.
+ */
+template<class T>
+inline size_t PackBlock4(const T* block, const __m128i values, const unsigned mask, T* output, const size_t room)
+{
+#if defined(__SSSE3__)
+    if(room >= 4)
+    {
+        const __m128i order = _mm_load_si128(reinterpret_cast<const __m128i*>(packTables.bytes[mask]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_shuffle_epi8(values, order));
+
+        return static_cast<size_t>(__builtin_popcount(mask));
+    }
+#else
+    (void)values;
+#endif
+
+    return PackScalar(block, mask, 4, output, room);
+}
+#endif
+
+#if defined(__AVX2__)
+/**
+ * @brief   Marks the elements of a block of 8 found anywhere in another block of 8.
+ * @return  Bit i is set if first[i] is in the second block.
+ */
+inline unsigned MatchBlock8(const __m256i first, const __m256i second)
+{
+    // Rotations within the 128-bit halves, then the same with the halves exchanged
+    const __m256i swapped = _mm256_permute2x128_si256(second, second, 1);
+
+    __m256i match = _mm256_cmpeq_epi32(first, second);
+    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(first, _mm256_shuffle_epi32(second, _MM_SHUFFLE(0, 3, 2, 1))));
+    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(first, _mm256_shuffle_epi32(second, _MM_SHUFFLE(1, 0, 3, 2))));
+    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(first, _mm256_shuffle_epi32(second, _MM_SHUFFLE(2, 1, 0, 3))));
+    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(first, swapped));
+    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(first, _mm256_shuffle_epi32(swapped, _MM_SHUFFLE(0, 3, 2, 1))));
+    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(first, _mm256_shuffle_epi32(swapped, _MM_SHUFFLE(1, 0, 3, 2))));
+    match = _mm256_or_si256(match, _mm256_cmpeq_epi32(first, _mm256_shuffle_epi32(swapped, _MM_SHUFFLE(2, 1, 0, 3))));
+
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(match)));
+}
+
+/**
+ * @brief   Writes the marked elements of a block of 8.
+ * @return  Number of elements written.
+ */
+template<class T>
+inline size_t PackBlock8(const T* block, const __m256i values, const unsigned mask, T* output, const size_t room)
+{
+    if(room < 8)
+        return PackScalar(block, mask, 8, output, room);
+
+    const __m256i order = _mm256_load_si256(reinterpret_cast<const __m256i*>(packTables.lanes[mask]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permutevar8x32_epi32(values, order));
+
+    return static_cast<size_t>(__builtin_popcount(mask));
+}
+#endif
+
+/**
+ * @brief   Intersection comparing blocks of both arrays, the block of the smaller last element is advanced.
+ * @return  Number of common elements written into the output.
+ * @note    The output must hold min(firstSize, secondSize) elements.
+ */
+template<class T>
+size_t IntersectBlocks(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    const size_t limit = (firstSize < secondSize) ? firstSize : secondSize;
+    size_t i = 0, j = 0, count = 0;
+
+#if defined(__AVX2__)
+    while((i + 8 <= firstSize) && (j + 8 <= secondSize))
+    {
+        const __m256i left  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+        const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + j));
+
+        count += PackBlock8(first + i, left, MatchBlock8(left, right), output + count, limit - count);
+
+        const T leftLast = first[i + 7], rightLast = second[j + 7];
+        i += (leftLast <= rightLast) ? 8 : 0;
+        j += (rightLast <= leftLast) ? 8 : 0;
+    }
+#elif defined(__SSE2__)
+    while((i + 4 <= firstSize) && (j + 4 <= secondSize))
+    {
+        const __m128i left  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + j));
+
+        count += PackBlock4(first + i, left, MatchBlock4(left, right), output + count, limit - count);
+
+        const T leftLast = first[i + 3], rightLast = second[j + 3];
+        i += (leftLast <= rightLast) ? 4 : 0;
+        j += (rightLast <= leftLast) ? 4 : 0;
+    }
+#endif
+
+    // The elements of a block already matched are less than second[j], the merge does not find them again
+    return count + IntersectScalar(first + i, firstSize - i, second + j, secondSize - j, output + count);
+}
+
+/**
+ * @brief   Difference comparing blocks of both arrays, a block of the first array is written when it is advanced.
+ * @return  Number of elements of the first array written into the output.
+ */
+template<class T>
+size_t DifferenceBlocks(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    size_t i = 0, j = 0, count = 0;
+    unsigned found = 0;     // Elements of the current block of the first array found so far
+
+#if defined(__AVX2__)
+    while((i + 8 <= firstSize) && (j + 8 <= secondSize))
+    {
+        const __m256i left  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i));
+        const __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + j));
+
+        found |= MatchBlock8(left, right);
+
+        const T leftLast = first[i + 7], rightLast = second[j + 7];
+        if(leftLast <= rightLast)   // No later block of the second array can match this block
+        {
+            count  += PackBlock8(first + i, left, ~found & 0xFF, output + count, firstSize - count);
+            found   = 0;
+            i      += 8;
+        }
+
+        j += (rightLast <= leftLast) ? 8 : 0;
+    }
+#elif defined(__SSE2__)
+    while((i + 4 <= firstSize) && (j + 4 <= secondSize))
+    {
+        const __m128i left  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+        const __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + j));
+
+        found |= MatchBlock4(left, right);
+
+        const T leftLast = first[i + 3], rightLast = second[j + 3];
+        if(leftLast <= rightLast)   // No later block of the second array can match this block
+        {
+            count  += PackBlock4(first + i, left, ~found & 0xF, output + count, firstSize - count);
+            found   = 0;
+            i      += 4;
+        }
+
+        j += (rightLast <= leftLast) ? 4 : 0;
+    }
+#endif
+
+    return count + DifferenceScalar(first + i, firstSize - i, second + j, secondSize - j, output + count, found);
+}
+
+/**
+ * @brief   Merge union, an element found in both arrays is written once.
+ * @return  Number of elements written into the output.
+ * @note    Unlike the other merges this one branches, a branch-free union is bound by the latency of
+ *          the load feeding the next comparison and turned out slower than the mispredictions.
+ */
+template<class T>
+size_t UnionScalar(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    size_t i = 0, j = 0, count = 0;
+
+    while((i < firstSize) && (j < secondSize))
+    {
+        if(first[i] < second[j])
+            output[count++] = first[i++];
+        else if(second[j] < first[i])
+            output[count++] = second[j++];
+        else
+        {
+            output[count++] = first[i++];
+            j++;
+        }
+    }
+
+    std::copy(first + i, first + firstSize, output + count);
+    count += firstSize - i;
+    std::copy(second + j, second + secondSize, output + count);
+    count += secondSize - j;
+
+    return count;
+}
+
+#if defined(__SSE4_1__)
+/**
+ * @brief   Sorts two sorted blocks of 4 into the 4 smallest and the 4 largest elements, by a merging network.
+ * @param   first       Sorted block
+ * @param   second      Sorted block
+ * @param   smallest    Set to the 4 smallest elements in ascending order
+ * @param   largest     Set to the 4 largest elements in ascending order
+ */
+template<class T>
+inline void MergeBlock4(const __m128i first, const __m128i second, __m128i& smallest, __m128i& largest)
+{
+    auto minimum = [](const __m128i left, const __m128i right)
+    { return std::is_signed<T>::value ? _mm_min_epi32(left, right) : _mm_min_epu32(left, right); };
+    auto maximum = [](const __m128i left, const __m128i right)
+    { return std::is_signed<T>::value ? _mm_max_epi32(left, right) : _mm_max_epu32(left, right); };
+
+    // Each rotation moves the next candidates against the running maximums
+    __m128i low = minimum(first, second);
+    largest     = maximum(first, second);
+
+    for(int step = 0; step < 3; step++)
+    {
+        low         = _mm_alignr_epi8(low, low, 4);
+        smallest    = minimum(low, largest);
+        largest     = maximum(low, largest);
+        low         = smallest;
+    }
+
+    smallest = _mm_alignr_epi8(smallest, smallest, 4);
+}
+
+/**
+ * @brief   Writes a sorted block without the elements equal to their predecessor.
+ * @param   previous    Block written before, its last element precedes the first one of this block.
+ * @param   block       Sorted block
+ * @param   output      Room for 4 elements.
+ * @return  Number of elements written.
+ */
+inline size_t StoreUnique4(const __m128i previous, const __m128i block, void* output)
+{
+    const __m128i shifted   = _mm_alignr_epi8(block, previous, 12);     // The predecessor of each lane
+    const unsigned repeated = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, shifted))));
+    const unsigned kept     = ~repeated & 0xF;
+
+    const __m128i order = _mm_load_si128(reinterpret_cast<const __m128i*>(packTables.bytes[kept]));
+    _mm_storeu_si128(static_cast<__m128i*>(output), _mm_shuffle_epi8(block, order));
+
+    return static_cast<size_t>(__builtin_popcount(kept));
+}
+
+/**
+ * @brief   Union merging blocks of 4 with a merging network, the equal neighbours are dropped while storing.
+ * @return  Number of elements written into the output.
+ * @note    The block of the smaller first element is taken next, the 4 largest elements wait for it.
+ */
+template<class T>
+size_t UnionBlocks(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    if((firstSize < 4) || (secondSize < 4))
+        return UnionScalar(first, firstSize, second, secondSize, output);
+
+    __m128i smallest, largest, next;
+    MergeBlock4<T>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first)),
+                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(second)), smallest, largest);
+
+    // The very first element has no predecessor, any other value is put before it
+    const __m128i start = _mm_xor_si128(_mm_shuffle_epi32(smallest, 0), _mm_set1_epi32(-1));
+
+    size_t i = 4, j = 4;
+    size_t count        = StoreUnique4(start, smallest, output);
+    __m128i previous    = smallest;
+
+    while((i + 4 <= firstSize) && (j + 4 <= secondSize))
+    {
+        if(first[i] <= second[j])
+        {
+            next    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i));
+            i      += 4;
+        }
+        else
+        {
+            next    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(second + j));
+            j      += 4;
+        }
+
+        MergeBlock4<T>(next, largest, smallest, largest);
+        count      += StoreUnique4(previous, smallest, output + count);
+        previous    = smallest;
+    }
+
+    // The waiting elements and the rest of the exhausted array, sorted and unique, are merged with the other rest
+    T leftover[4];
+    const size_t leftoverSize = StoreUnique4(previous, largest, leftover);
+
+    const T* rest       = (i + 4 > firstSize) ? (first + i) : (second + j);
+    const size_t restSize = (i + 4 > firstSize) ? (firstSize - i) : (secondSize - j);
+    const T* other      = (i + 4 > firstSize) ? (second + j) : (first + i);
+    const size_t otherSize = (i + 4 > firstSize) ? (secondSize - j) : (firstSize - i);
+
+    T merged[8];
+    const size_t mergedSize = std::unique(merged, std::merge(leftover, leftover + leftoverSize, rest, rest + restSize, merged)) - merged;
+
+    // Everything left is greater than the last element written
+    return count + UnionScalar(merged, mergedSize, other, otherSize, output + count);
+}
+#endif
+
+/**
+ * @brief   Union by galloping, runs of the long array between the elements of the short one are copied at once.
+ * @return  Number of elements written into the output.
+ */
+template<class T>
+size_t UnionGalloping(const T* shorter, const size_t shorterSize, const T* longer, const size_t longerSize, T* output)
+{
+    size_t position = 0, count = 0;
+
+    for(size_t index = 0; index < shorterSize; index++)
+    {
+        const size_t next = GallopLowerBound(longer, position, longerSize, shorter[index]);
+
+        std::copy(longer + position, longer + position + (next - position), output + count);
+        count      += next - position;
+        position    = next;
+
+        output[count++] = shorter[index];
+        position       += ((position < longerSize) && (longer[position] == shorter[index])) ? 1 : 0;
+    }
+
+    std::copy(longer + position, longer + position + (longerSize - position), output + count);
+    count += longerSize - position;
+
+    return count;
+}
+
+/**
+ * @brief   Intersection of two sorted ranges, the kernel is chosen by the sizes and the element type.
+ * @return  Number of common elements written into the output, which must hold min(firstSize, secondSize) elements.
+ */
+template<class T>
+size_t Intersect(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    if(firstSize > secondSize)  // The first one is the shorter one from here on
+        return Intersect(second, secondSize, first, firstSize, output);
+
+    if(firstSize == 0)
+        return 0;
+
+    if(secondSize / firstSize >= gallopRatio)
+        return IntersectGalloping(first, firstSize, second, secondSize, output);
+
+    if constexpr(isBlockLane<T>)
+        return IntersectBlocks(first, firstSize, second, secondSize, output);
+    else
+        return IntersectScalar(first, firstSize, second, secondSize, output);
+}
+
+/**
+ * @brief   Union of two sorted ranges.
+ * @return  Number of elements written into the output, which must hold firstSize + secondSize elements.
+ */
+template<class T>
+size_t Union(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    if(firstSize > secondSize)
+        return Union(second, secondSize, first, firstSize, output);
+
+    if((firstSize == 0) || (secondSize / firstSize >= gallopRatio))
+        return UnionGalloping(first, firstSize, second, secondSize, output);
+
+#if defined(__SSE4_1__)
+    if constexpr(isBlockLane<T>)
+        return UnionBlocks(first, firstSize, second, secondSize, output);
+#endif
+
+    return UnionScalar(first, firstSize, second, secondSize, output);
+}
+
+/**
+ * @brief   Elements of the first sorted range which are not in the second one.
+ * @return  Number of elements written into the output, which must hold firstSize elements.
+ */
+template<class T>
+size_t Difference(const T* first, const size_t firstSize, const T* second, const size_t secondSize, T* output)
+{
+    if((firstSize == 0) || (secondSize == 0))
+        return DifferenceGalloping(first, firstSize, second, secondSize, output);
+
+    // When the kept array is the long one, the block compares keep up with the copies of its runs for longer
+    const bool keptIsLonger = (firstSize > secondSize);
+    const size_t ratio      = keptIsLonger ? (firstSize / secondSize) : (secondSize / firstSize);
+
+    if(ratio >= (keptIsLonger ? gallopRatio * 8 : gallopRatio))
+        return DifferenceGalloping(first, firstSize, second, secondSize, output);
+
+    if constexpr(isBlockLane<T>)
+        return DifferenceBlocks(first, firstSize, second, secondSize, output);
+    else
+        return DifferenceScalar(first, firstSize, second, secondSize, output);
+}
+
+/**
+ * @brief   Checks the room of the output array.
+ * @throws  std::invalid_argument If the output holds less than the required number of elements.
+ */
+template<class T>
+inline void RequireRoom(const Array<T>& output, const size_t required)
+{
+    if(output.getSize() < required)
+        throw std::invalid_argument("Output array is too small! (Size = " + std::to_string(output.getSize()) +
+                                    ") (Required = " + std::to_string(required) + ")");
+}
+
+} // namespace SortedKernels
+
+/**
+ * @brief   Writes the elements found in both of two sorted arrays into the output.
+ * @param   first   Sorted array without duplicates
+ * @param   second  Sorted array without duplicates
+ * @param   output  Preallocated array of at least min(first.getSize(), second.getSize()) elements,
+ *                  the result fills its front and the elements past it are unspecified.
+ * @return  Number of elements written.
+ * @throws  std::invalid_argument If the output is too small.
+ */
+template<class T>
+size_t IntersectSorted(const Array<T>& first, const Array<T>& second, Array<T>& output)
+{
+    static_assert(std::is_integral<T>::value, "Sorted array kernels are for integer elements!");
+
+    SortedKernels::RequireRoom(output, (first.getSize() < second.getSize()) ? first.getSize() : second.getSize());
+
+    return SortedKernels::Intersect(first.begin(), first.getSize(), second.begin(), second.getSize(), output.begin());
+}
+
+/**
+ * @brief   Writes the elements found in any of two sorted arrays into the output, in ascending order.
+ * @param   first   Sorted array without duplicates
+ * @param   second  Sorted array without duplicates
+ * @param   output  Preallocated array of at least first.getSize() + second.getSize() elements,
+ *                  the result fills its front and the elements past it are unspecified.
+ * @return  Number of elements written, a common element is written once.
+ * @throws  std::invalid_argument If the output is too small.
+ */
+template<class T>
+size_t UnionSorted(const Array<T>& first, const Array<T>& second, Array<T>& output)
+{
+    static_assert(std::is_integral<T>::value, "Sorted array kernels are for integer elements!");
+
+    SortedKernels::RequireRoom(output, first.getSize() + second.getSize());
+
+    return SortedKernels::Union(first.begin(), first.getSize(), second.begin(), second.getSize(), output.begin());
+}
+
+/**
+ * @brief   Writes the elements of the first sorted array which are not in the second one into the output.
+ * @param   first   Sorted array without duplicates
+ * @param   second  Sorted array without duplicates
+ * @param   output  Preallocated array of at least first.getSize() elements,
+ *                  the result fills its front and the elements past it are unspecified.
+ * @return  Number of elements written.
+ * @throws  std::invalid_argument If the output is too small.
+ */
+template<class T>
+size_t DifferenceSorted(const Array<T>& first, const Array<T>& second, Array<T>& output)
+{
+    static_assert(std::is_integral<T>::value, "Sorted array kernels are for integer elements!");
+
+    SortedKernels::RequireRoom(output, first.getSize());
+
+    return SortedKernels::Difference(first.begin(), first.getSize(), second.begin(), second.getSize(), output.begin());
+}
+
+#endif  // Prevent recursive inclusion
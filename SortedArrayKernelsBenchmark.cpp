@@ -0,0 +1,136 @@
+// Description: Throughput of the sorted array kernels against the standard merge algorithms, across selectivities and size ratios
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -march=native SortedArrayKernelsBenchmark.cpp -o SortedArrayKernelsBenchmark
+//              (without -march the SSE2 kernels are used, with -mavx2 the 8 element blocks)
+// Usage:       ./SortedArrayKernelsBenchmark [elements]
+//              (default: 1000000 elements in the longer array)
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "SortedArrayKernels.h"
+
+using namespace std;
+
+static const size_t repetitions = 5;
+
+/**
+ * Two sorted posting lists without duplicates, the given share of the shorter one is also in the longer one.
+ * The ids grow by random gaps, the order of the owners is random, so the merges cannot predict their branches.
+ */
+static void MakeLists(const size_t shorterSize, const size_t longerSize, const double selectivity, mt19937& generator,
+                      vector<uint32_t>& shorter, vector<uint32_t>& longer)
+{
+    const size_t common = static_cast<size_t>(shorterSize * selectivity);
+
+    vector<uint8_t> owners;     // 0: both, 1: shorter only, 2: longer only
+    owners.insert(owners.end(), common, 0);
+    owners.insert(owners.end(), shorterSize - common, 1);
+    owners.insert(owners.end(), longerSize - common, 2);
+    shuffle(owners.begin(), owners.end(), generator);
+
+    shorter.clear();
+    longer.clear();
+
+    uint32_t id = 0;
+    for(const uint8_t owner : owners)
+    {
+        id += 1 + generator() % 8;
+
+        if(owner != 2)
+            shorter.push_back(id);
+        if(owner != 1)
+            longer.push_back(id);
+    }
+}
+
+static void PrintRow(const char* operation, const string& shape, const char* method, const size_t bytes,
+                     const size_t resultSize, const double seconds)
+{
+    cout << setw(14) << left << operation << setw(14) << shape << setw(22) << method << right
+         << setw(10) << resultSize << setw(10) << fixed << setprecision(2) << bytes / seconds / 1e9 << " GB/s" << endl;
+}
+
+int main(int argc, char** argv)
+{
+    const size_t elements = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 1000000;
+    mt19937 generator(19);
+
+    cout << setw(14) << left << "operation" << setw(14) << "shape" << setw(22) << "method" << right
+         << setw(10) << "result" << setw(15) << "throughput" << endl;
+
+    vector<uint32_t> shorterIds, longerIds;
+
+    // Equal sizes, from a few to most elements in common
+    for(const double selectivity : {0.01, 0.1, 0.5, 0.9})
+    {
+        MakeLists(elements, elements, selectivity, generator, shorterIds, longerIds);
+
+        const Array<uint32_t> first(shorterIds.begin(), shorterIds.end());
+        const Array<uint32_t> second(longerIds.begin(), longerIds.end());
+        Array<uint32_t> output(first.getSize() + second.getSize());
+
+        const size_t bytes  = (first.getSize() + second.getSize()) * sizeof(uint32_t);
+        const string shape  = "sel " + to_string(static_cast<int>(selectivity * 100)) + "%";
+        size_t resultSize   = 0;
+
+        double seconds = Benchmark::MeasureBest(repetitions, [&]()
+        { resultSize = set_intersection(first.begin(), first.end(), second.begin(), second.end(), output.begin()) - output.begin(); });
+        PrintRow("intersection", shape, "std::set_intersection", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]() { resultSize = IntersectSorted(first, second, output); });
+        PrintRow("intersection", shape, "IntersectSorted", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]()
+        { resultSize = set_union(first.begin(), first.end(), second.begin(), second.end(), output.begin()) - output.begin(); });
+        PrintRow("union", shape, "std::set_union", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]() { resultSize = UnionSorted(first, second, output); });
+        PrintRow("union", shape, "UnionSorted", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]()
+        { resultSize = set_difference(first.begin(), first.end(), second.begin(), second.end(), output.begin()) - output.begin(); });
+        PrintRow("difference", shape, "std::set_difference", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]() { resultSize = DifferenceSorted(first, second, output); });
+        PrintRow("difference", shape, "DifferenceSorted", bytes, resultSize, seconds);
+    }
+
+    // Skewed sizes, a rare term against a frequent one, half of the rare one is common
+    for(const size_t ratio : {4, 16, 64, 1024})
+    {
+        MakeLists(max<size_t>(elements / ratio, 1), elements, 0.5, generator, shorterIds, longerIds);
+
+        const Array<uint32_t> first(shorterIds.begin(), shorterIds.end());
+        const Array<uint32_t> second(longerIds.begin(), longerIds.end());
+        Array<uint32_t> output(first.getSize() + second.getSize());
+
+        const size_t bytes  = (first.getSize() + second.getSize()) * sizeof(uint32_t);
+        const string shape  = "1:" + to_string(ratio);
+        size_t resultSize   = 0;
+
+        double seconds = Benchmark::MeasureBest(repetitions, [&]()
+        { resultSize = set_intersection(first.begin(), first.end(), second.begin(), second.end(), output.begin()) - output.begin(); });
+        PrintRow("intersection", shape, "std::set_intersection", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]() { resultSize = IntersectSorted(first, second, output); });
+        PrintRow("intersection", shape, "IntersectSorted", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]()
+        { resultSize = set_difference(second.begin(), second.end(), first.begin(), first.end(), output.begin()) - output.begin(); });
+        PrintRow("difference", shape, "std::set_difference", bytes, resultSize, seconds);
+
+        seconds = Benchmark::MeasureBest(repetitions, [&]() { resultSize = DifferenceSorted(second, first, output); });
+        PrintRow("difference", shape, "DifferenceSorted", bytes, resultSize, seconds);
+    }
+
+    return 0;
+}
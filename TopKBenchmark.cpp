@@ -0,0 +1,104 @@
+// Description: Top-k selection of List and Array against sorting the whole container
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread TopKBenchmark.cpp -o TopKBenchmark
+// Usage:       ./TopKBenchmark [array size] [k] [threads]
+//              (defaults: 10000000, 100 and the hardware concurrency)
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <optional>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <cstdlib>
+
+#include "Benchmark.h"
+#include "ListContainer.h"
+#include "ArrayContainer.h"
+#include "ParallelSelection.h"
+
+using namespace std;
+
+static const size_t repetitions = 3;
+
+static void PrintRow(const string& container, const string& method, const size_t size, const double seconds)
+{
+    cout << setw(8) << left << container << setw(16) << method << right << setw(12) << size
+         << setw(12) << fixed << setprecision(2) << seconds * 1000 << endl;
+}
+
+// Every call reorders the list, so each repetition starts from a fresh copy
+template<class CallType>
+static double MeasureList(const vector<uint32_t>& values, CallType call)
+{
+    optional<List<uint32_t>> list;
+
+    return Benchmark::MeasureBest(repetitions,
+        [&]() { list.reset(); list.emplace(values.begin(), values.end()); },
+        [&]() { call(*list); });
+}
+
+template<class CallType>
+static double MeasureArray(const vector<uint32_t>& values, CallType call)
+{
+    Array<uint32_t> array(values.begin(), values.end());
+
+    return Benchmark::MeasureBest(repetitions,
+        [&]() { std::copy(values.begin(), values.end(), array.begin()); },
+        [&]() { call(array); });
+}
+
+int main(int argc, char** argv)
+{
+    const size_t arraySize  = (argc > 1) ? strtoul(argv[1], nullptr, 10) : 10000000;
+    const size_t k          = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 100;
+    const size_t threads    = (argc > 3) ? strtoul(argv[3], nullptr, 10) : 0;
+
+    mt19937 generator(11);
+
+    cout << setw(8) << left << "type" << setw(16) << "method" << right << setw(12) << "size" << setw(12) << "ms" << endl;
+
+    // List::Sort is quadratic, it is compared on the small list only
+    for(const size_t listSize : {size_t(16384), size_t(2097152)})
+    {
+        vector<uint32_t> values(listSize);
+        for(uint32_t& value : values)
+            value = generator();
+
+        if(listSize <= 16384)
+            PrintRow("List", "Sort", listSize, MeasureList(values, [](List<uint32_t>& list) { list.Sort(); }));
+
+        PrintRow("List", "PartialSort", listSize, MeasureList(values, [&](List<uint32_t>& list) { list.PartialSort(k); }));
+        PrintRow("List", "NthElement", listSize, MeasureList(values, [&](List<uint32_t>& list) { list.NthElement(k); }));
+        PrintRow("List", "TopK", listSize, MeasureList(values, [&](List<uint32_t>& list)
+        {
+            List<uint32_t> selected = list.TopK(k, greater<uint32_t>());
+            Benchmark::DoNotOptimize(selected);
+        }));
+    }
+
+    vector<uint32_t> values(arraySize);
+    for(uint32_t& value : values)
+        value = generator();
+
+    PrintRow("Array", "std::sort", arraySize, MeasureArray(values, [](Array<uint32_t>& array) { std::sort(array.begin(), array.end()); }));
+    PrintRow("Array", "PartialSort", arraySize, MeasureArray(values, [&](Array<uint32_t>& array) { array.PartialSort(k); }));
+    PrintRow("Array", "NthElement", arraySize, MeasureArray(values, [&](Array<uint32_t>& array) { array.NthElement(k); }));
+    PrintRow("Array", "TopK", arraySize, MeasureArray(values, [&](Array<uint32_t>& array)
+    {
+        Array<uint32_t> selected = array.TopK(k);
+        Benchmark::DoNotOptimize(selected);
+    }));
+    PrintRow("Array", "ParallelTopK", arraySize, MeasureArray(values, [&](Array<uint32_t>& array)
+    {
+        Array<uint32_t> selected = ParallelTopK(array, k, less<uint32_t>(), threads);
+        Benchmark::DoNotOptimize(selected);
+    }));
+
+    return 0;
+}
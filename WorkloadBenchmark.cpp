@@ -0,0 +1,96 @@
+// Description: Mixed-workload throughput and latency over time of List, Array and the standard containers
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 -pthread WorkloadBenchmark.cpp -o WorkloadBenchmark
+// Usage:       ./WorkloadBenchmark [backend] [mix] [uniform|zipf] [threads] [seconds] [seed] [json path]
+//              (defaults: all, 60,20,10,10, uniform, 1, 2 and 1; mix weights are Append,RemoveFirst,Find,Splice)
+//              backend is one of List, Array, std::list, std::vector, std::deque or all
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "WorkloadDriver.h"
+
+using namespace std;
+using namespace Benchmark;
+
+// Runs the backend if it is selected and appends its report to the JSON array
+template<class BackendType>
+static void Run(const string& selected, const WorkloadConfig& config, ostream* json, size_t& runs)
+{
+    if((selected != "all") && (selected != BackendType::Name()))
+        return;
+
+    const WorkloadReport report = RunWorkload<BackendType>(config);
+    report.WriteText(cout);
+    cout << endl;
+
+    if(json != nullptr)
+    {
+        *json << ((runs == 0) ? "[\n" : ",\n");
+        report.WriteJson(*json);
+    }
+
+    runs++;
+}
+
+int main(int argc, char** argv)
+{
+    const string backend = (argc > 1) ? argv[1] : "all";
+    WorkloadConfig config;
+
+    try
+    {
+        if(argc > 2)
+            config.ParseMix(argv[2]);
+
+        if(argc > 3)
+        {
+            const string distribution = argv[3];
+
+            if(distribution == "zipf")
+                config.distribution = KeyDistribution::Zipf;
+            else if(distribution != "uniform")
+                throw invalid_argument("Unknown key distribution: " + distribution);
+            else;
+        }
+
+        config.threads          = (argc > 4) ? strtoul(argv[4], nullptr, 10) : 1;
+        config.durationSeconds  = (argc > 5) ? strtod(argv[5], nullptr) : 2;
+        config.seed             = (argc > 6) ? strtoull(argv[6], nullptr, 10) : 1;
+
+        ofstream jsonFile;
+        if(argc > 7)
+        {
+            jsonFile.open(argv[7]);
+            if(jsonFile.is_open() == false)
+                throw runtime_error(string("Cannot open ") + argv[7]);
+        }
+
+        ostream* json = jsonFile.is_open() ? &jsonFile : nullptr;
+        size_t runs = 0;
+
+        Run<ListBackend>(backend, config, json, runs);
+        Run<ArrayBackend>(backend, config, json, runs);
+        Run<StandardBackend<std::list<uint64_t>>>(backend, config, json, runs);
+        Run<StandardBackend<std::vector<uint64_t>>>(backend, config, json, runs);
+        Run<StandardBackend<std::deque<uint64_t>>>(backend, config, json, runs);
+
+        if(runs == 0)
+            throw invalid_argument("Unknown backend: " + backend);
+
+        if(json != nullptr)
+            *json << "]\n";
+    }
+    catch(const exception& error)
+    {
+        cerr << error.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,651 @@
+/** @file       WorkloadDriver.h
+ *  @details    Randomized mixed-workload driver for the containers of the repo.
+ *              A configurable mix of Append, RemoveFirst, Find and Splice operations is replayed
+ *              against a backend by several threads, with seeded keys drawn from a uniform or a zipf
+ *              distribution. Throughput and latency are reported per time interval as well as in
+ *              total, so degradation over a long run (fragmentation, cache pollution) becomes visible.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       Each thread drives its own backend instance, the threads interfere through the
+ *              allocator and the shared caches only.
+ *  @note       A backend is any default constructible class with the members
+ *              Append(key), RemoveFirst(), Find(key), Splice(keys), GetSize() and a static Name().
+ *  @note       Link with -pthread.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef WORKLOAD_DRIVER_H
+#define WORKLOAD_DRIVER_H
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <list>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+#include <cmath>
+#include <cstdint>
+
+#include "ArrayContainer.h"
+#include "ListContainer.h"
+#include "LatencyHistogram.h"
+
+namespace Benchmark {
+
+/**
+ * @brief   Operations of the mixed workload.
+ */
+enum class WorkloadOperation{
+    Append = 0,     // Adds a key at the back
+    RemoveFirst,    // Removes the front element, no-op when empty
+    Find,           // Linear search of a key
+    Splice,         // Inserts a batch of keys after the front element
+    Count           // Number of operations, not an operation
+};
+
+constexpr size_t workloadOperationCount = static_cast<size_t>(WorkloadOperation::Count);
+
+/**
+ * @brief   Names used in reports, in the order of WorkloadOperation.
+ */
+inline const char* WorkloadOperationName(const WorkloadOperation operation)
+{
+    static const char* const names[workloadOperationCount] = {"Append", "RemoveFirst", "Find", "Splice"};
+    return names[static_cast<size_t>(operation)];
+}
+
+/**
+ * @brief   Distribution of the keys used by Append, Find and Splice.
+ */
+enum class KeyDistribution{
+    Uniform,    // Every key of the key space is equally likely
+    Zipf        // Key k is drawn with a probability proportional to 1 / (k + 1)^skew
+};
+
+/**
+ * @brief   Parameters of a workload run.
+ */
+struct WorkloadConfig{
+    unsigned weights[workloadOperationCount] = {60, 20, 10, 10};    // Relative frequencies of the operations
+    KeyDistribution distribution    = KeyDistribution::Uniform;
+    double zipfSkew                 = 0.99;
+    uint64_t keySpace               = 100000;   // Keys are drawn from [0, keySpace)
+    size_t initialSize              = 10000;    // Elements per thread before the measurement
+    size_t spliceLength             = 16;       // Keys inserted by a single Splice
+    size_t threads                  = 1;
+    double durationSeconds          = 2;
+    uint64_t operationsPerThread    = 0;        // Stops earlier when reached, zero for no limit
+    double intervalSeconds          = 0.25;     // Resolution of the time series
+    uint64_t seed                   = 1;
+
+    void ParseMix(const std::string& mix);      // Parses "append,removefirst,find,splice" weights, e.g. "60,20,10,10"
+    std::string MixToText() const;
+};
+
+/**
+ * @brief   Parses the operation weights.
+ * @param   mix     Comma separated weights in the order of WorkloadOperation, e.g. "60,20,10,10".
+ * @throws  std::invalid_argument If the text is malformed or all weights are zero.
+ */
+inline void WorkloadConfig::ParseMix(const std::string& mix)
+{
+    std::istringstream stream(mix);
+    unsigned parsed[workloadOperationCount] = {};
+    unsigned sum = 0;
+
+    for(size_t index = 0; index < workloadOperationCount; index++)
+    {
+        char separator = ',';
+        if(((index != 0) && ((stream >> separator).fail() || (separator != ','))) || (stream >> parsed[index]).fail())
+            throw std::invalid_argument("Malformed operation mix: " + mix);
+
+        sum += parsed[index];
+    }
+
+    if((stream >> std::ws).eof() == false)
+        throw std::invalid_argument("Malformed operation mix: " + mix);
+
+    if(sum == 0)
+        throw std::invalid_argument("Operation mix cannot be all zero!");
+
+    std::copy(parsed, parsed + workloadOperationCount, weights);
+}
+
+/**
+ * @brief   Formats the weights as percentages.
+ * @return  Text of the form "Append=60% RemoveFirst=20% ...".
+ */
+inline std::string WorkloadConfig::MixToText() const
+{
+    unsigned sum = 0;
+    for(const unsigned weight : weights)
+        sum += weight;
+
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(0);
+
+    for(size_t index = 0; index < workloadOperationCount; index++)
+        text << ((index == 0) ? "" : " ") << WorkloadOperationName(static_cast<WorkloadOperation>(index))
+             << "=" << ((sum == 0) ? 0.0 : 100.0 * weights[index] / sum) << "%";
+
+    return text.str();
+}
+
+/**
+ * @brief   Seeded generator of keys and operations, one per thread.
+ */
+class WorkloadGenerator{
+public:
+    WorkloadGenerator(const WorkloadConfig& config, const std::vector<double>& zipfTable, const uint64_t stream);
+
+    uint64_t NextKey();
+    WorkloadOperation NextOperation();
+
+    static std::vector<double> BuildZipfTable(const uint64_t keySpace, const double skew);  // Cumulative probabilities
+
+private:
+    const WorkloadConfig& config;
+    const std::vector<double>& zipfTable;   // Shared by all threads, empty for uniform keys
+    std::mt19937_64 engine;
+    std::uniform_int_distribution<uint64_t> uniformKey;
+    std::uniform_real_distribution<double> unit{0.0, 1.0};
+    std::discrete_distribution<size_t> operation;
+};
+
+/**
+ * @brief   Constructs a generator whose sequence depends only on the seed and the stream.
+ * @param   config      Workload parameters.
+ * @param   zipfTable   Cumulative probabilities, see BuildZipfTable().
+ * @param   stream      Index of the thread, gives each thread its own sequence.
+ */
+inline WorkloadGenerator::WorkloadGenerator(const WorkloadConfig& config, const std::vector<double>& zipfTable, const uint64_t stream)
+: config(config), zipfTable(zipfTable), uniformKey(0, (config.keySpace == 0) ? 0 : config.keySpace - 1),
+  operation(config.weights, config.weights + workloadOperationCount)
+{
+    std::seed_seq sequence{static_cast<uint32_t>(config.seed), static_cast<uint32_t>(config.seed >> 32), static_cast<uint32_t>(stream)};
+    engine.seed(sequence);
+}
+
+/**
+ * @brief   Draws a key from the configured distribution.
+ * @return  Key in [0, keySpace).
+ */
+inline uint64_t WorkloadGenerator::NextKey()
+{
+    if((config.distribution == KeyDistribution::Zipf) && (zipfTable.empty() == false))
+    {
+        const double point = unit(engine);
+        return static_cast<uint64_t>(std::lower_bound(zipfTable.begin(), zipfTable.end() - 1, point) - zipfTable.begin());
+    }
+
+    return uniformKey(engine);
+}
+
+/**
+ * @brief   Draws the next operation according to the weights.
+ */
+inline WorkloadOperation WorkloadGenerator::NextOperation()
+{
+    return static_cast<WorkloadOperation>(operation(engine));
+}
+
+/**
+ * @brief   Computes the cumulative probabilities of a zipf distribution.
+ * @param   keySpace    Number of keys.
+ * @param   skew        Exponent, larger values concentrate the draws on the small keys.
+ * @return  Table whose element k is the probability of drawing a key not greater than k.
+ */
+inline std::vector<double> WorkloadGenerator::BuildZipfTable(const uint64_t keySpace, const double skew)
+{
+    std::vector<double> table(keySpace);
+    double cumulative = 0;
+
+    for(uint64_t key = 0; key < keySpace; key++)
+    {
+        cumulative += 1.0 / std::pow(static_cast<double>(key + 1), skew);
+        table[key] = cumulative;
+    }
+
+    for(double& probability : table)
+        probability /= cumulative;
+
+    return table;
+}
+
+/**
+ * @brief   Workload backend on the List of the repo.
+ */
+class ListBackend{
+public:
+    static const char* Name()   { return "List"; }
+
+    void Append(const uint64_t key)     { list.Append(key); }
+    void RemoveFirst()                  { if(list.isEmpty() == false) list.RemoveFirst(); }
+    size_t GetSize() const              { return list.GetNodeCount(); }
+
+    bool Find(const uint64_t key)
+    {
+        if(list.isEmpty() == true)
+            return false;
+
+        // The end iterator of List points to the last element, not past it
+        for(List<uint64_t>::iterator it = list.begin(); ; ++it)
+        {
+            if(*it == key)
+                return true;
+
+            if(it == list.end())
+                return false;
+        }
+    }
+
+    void Splice(const std::vector<uint64_t>& keys)
+    {
+        if(keys.empty() == true)
+            return;
+
+        List<uint64_t> batch(keys.begin(), keys.end());
+
+        if(list.isEmpty() == true)
+            list.Concatenate(batch);
+        else
+            list.Splice(list.begin(), batch);
+    }
+
+private:
+    List<uint64_t> list;
+};
+
+/**
+ * @brief   Workload backend on the Array of the repo.
+ * @note    Array has a fixed size, so the backend keeps a logical size and doubles the capacity
+ *          by copying into a larger Array, like a growable vector built on top of it.
+ */
+class ArrayBackend{
+public:
+    static const char* Name()   { return "Array"; }
+
+    ArrayBackend() : array(new Array<uint64_t>(16))
+    { /* Empty constructor */ }
+
+    void Append(const uint64_t key)
+    {
+        Reserve(count + 1);
+        array->begin()[count++] = key;
+    }
+
+    void RemoveFirst()
+    {
+        if(count == 0)
+            return;
+
+        uint64_t* const elements = array->begin();
+        std::copy(elements + 1, elements + count, elements);
+        count--;
+    }
+
+    bool Find(const uint64_t key) const
+    { return std::find(array->begin(), array->begin() + count, key) != array->begin() + count; }
+
+    void Splice(const std::vector<uint64_t>& keys)
+    {
+        const size_t position = (count == 0) ? 0 : 1;   // After the first element, as List::Splice does
+
+        Reserve(count + keys.size());
+
+        uint64_t* const elements = array->begin();
+        std::copy_backward(elements + position, elements + count, elements + count + keys.size());
+        std::copy(keys.begin(), keys.end(), elements + position);
+        count += keys.size();
+    }
+
+    size_t GetSize() const  { return count; }
+
+private:
+    void Reserve(const size_t required)
+    {
+        if(required <= array->getSize())
+            return;
+
+        std::unique_ptr<Array<uint64_t>> grown(new Array<uint64_t>(std::max(required, 2 * array->getSize())));
+        std::copy(array->begin(), array->begin() + count, grown->begin());
+        array.swap(grown);
+    }
+
+    std::unique_ptr<Array<uint64_t>> array;
+    size_t count = 0;   // Used elements, the rest is spare capacity
+};
+
+/**
+ * @brief   Workload backend on a standard sequence container, for comparison.
+ */
+template<class ContainerType>
+class StandardBackend{
+public:
+    static const char* Name();
+
+    void Append(const uint64_t key)     { container.push_back(key); }
+    void RemoveFirst()                  { if(container.empty() == false) container.erase(container.begin()); }
+    size_t GetSize() const              { return container.size(); }
+
+    bool Find(const uint64_t key) const
+    { return std::find(container.begin(), container.end(), key) != container.end(); }
+
+    void Splice(const std::vector<uint64_t>& keys)
+    {
+        auto position = container.begin();
+        if(container.empty() == false)
+            ++position;
+
+        container.insert(position, keys.begin(), keys.end());
+    }
+
+private:
+    ContainerType container;
+};
+
+template<> inline const char* StandardBackend<std::list<uint64_t>>::Name()      { return "std::list";   }
+template<> inline const char* StandardBackend<std::vector<uint64_t>>::Name()    { return "std::vector"; }
+template<> inline const char* StandardBackend<std::deque<uint64_t>>::Name()     { return "std::deque";  }
+
+/**
+ * @brief   Measurements of one time interval, summed over all threads.
+ */
+struct WorkloadInterval{
+    double startSeconds     = 0;
+    uint64_t operations     = 0;
+    double throughput       = 0;    // Operations per second
+    uint64_t elements       = 0;    // Sum of the backend sizes, sampled as the threads enter the interval
+    LatencySummary latency;
+};
+
+/**
+ * @brief   Results of a workload run.
+ */
+struct WorkloadReport{
+    std::string backend;
+    WorkloadConfig config;
+    double seconds          = 0;
+    uint64_t operations     = 0;
+    uint64_t finalElements  = 0;
+    uint64_t findHits       = 0;
+    LatencySummary latencies[workloadOperationCount];
+    std::vector<WorkloadInterval> intervals;
+
+    double GetThroughput() const    { return (seconds > 0) ? operations / seconds : 0; }
+    double GetDegradation() const;  // Throughput of the last full interval over the first one
+
+    void WriteText(std::ostream& stream) const;
+    void WriteJson(std::ostream& stream) const;
+};
+
+/**
+ * @brief   Compares the end of the run with its beginning.
+ * @return  Ratio of the last and the first interval throughputs, below one when the run slowed down.
+ *          Zero if there are less than two intervals with operations.
+ */
+inline double WorkloadReport::GetDegradation() const
+{
+    std::vector<double> throughputs;
+    for(const WorkloadInterval& interval : intervals)
+        if(interval.operations != 0)
+            throughputs.push_back(interval.throughput);
+
+    // The last interval is usually cut short by the end of the run
+    if(throughputs.size() > 2)
+        throughputs.pop_back();
+
+    if((throughputs.size() < 2) || (throughputs.front() == 0))
+        return 0;
+
+    return throughputs.back() / throughputs.front();
+}
+
+/**
+ * @brief   Writes a human readable report with the time series.
+ * @param   stream  Destination stream.
+ */
+inline void WorkloadReport::WriteText(std::ostream& stream) const
+{
+    const std::ios::fmtflags flags      = stream.flags();
+    const std::streamsize precision     = stream.precision();
+
+    stream << backend << ": " << config.threads << " thread(s), " << config.MixToText()
+           << ", keys " << ((config.distribution == KeyDistribution::Zipf) ? "zipf" : "uniform") << "/" << config.keySpace
+           << ", seed " << config.seed << '\n'
+           << std::fixed << std::setprecision(3)
+           << "  " << operations << " operations in " << seconds << " s, "
+           << std::setprecision(0) << GetThroughput() << " ops/s, "
+           << finalElements << " elements left, degradation x" << std::setprecision(2) << GetDegradation() << '\n';
+
+    for(size_t index = 0; index < workloadOperationCount; index++)
+        if(latencies[index].count != 0)
+            stream << "  " << std::left << std::setw(12) << WorkloadOperationName(static_cast<WorkloadOperation>(index))
+                   << std::right << " " << latencies[index].ToText() << '\n';
+
+    stream << "  " << std::setw(8) << "time(s)" << std::setw(14) << "ops/s" << std::setw(12) << "elements"
+           << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(12) << "max(ns)" << '\n';
+
+    for(const WorkloadInterval& interval : intervals)
+    {
+        if(interval.operations == 0)
+            continue;
+
+        stream << "  " << std::setw(8) << std::setprecision(2) << interval.startSeconds
+               << std::setw(14) << std::setprecision(0) << interval.throughput
+               << std::setw(12) << interval.elements
+               << std::setw(10) << interval.latency.p50
+               << std::setw(10) << interval.latency.p99
+               << std::setw(12) << interval.latency.max << '\n';
+    }
+
+    stream.flags(flags);            // Leave the stream as it was
+    stream.precision(precision);
+}
+
+/**
+ * @brief   Writes the report as a single JSON object.
+ * @param   stream  Destination stream.
+ */
+inline void WorkloadReport::WriteJson(std::ostream& stream) const
+{
+    const std::ios::fmtflags flags      = stream.flags();
+    const std::streamsize precision     = stream.precision();
+
+    stream << std::fixed << std::setprecision(6)
+           << "{\"backend\":\"" << backend << "\",\"threads\":" << config.threads
+           << ",\"mix\":{";
+
+    for(size_t index = 0; index < workloadOperationCount; index++)
+        stream << ((index == 0) ? "" : ",") << "\"" << WorkloadOperationName(static_cast<WorkloadOperation>(index)) << "\":" << config.weights[index];
+
+    stream << "},\"distribution\":\"" << ((config.distribution == KeyDistribution::Zipf) ? "zipf" : "uniform")
+           << "\",\"keySpace\":" << config.keySpace << ",\"seed\":" << config.seed
+           << ",\"seconds\":" << seconds << ",\"operations\":" << operations
+           << ",\"throughput\":" << GetThroughput() << ",\"degradation\":" << GetDegradation()
+           << ",\"finalElements\":" << finalElements << ",\"latency\":{";
+
+    for(size_t index = 0; index < workloadOperationCount; index++)
+        stream << ((index == 0) ? "" : ",") << "\"" << WorkloadOperationName(static_cast<WorkloadOperation>(index)) << "\":" << latencies[index].ToJson();
+
+    stream << "},\"intervals\":[";
+
+    for(size_t index = 0; index < intervals.size(); index++)
+        stream << ((index == 0) ? "" : ",") << "{\"start\":" << intervals[index].startSeconds
+               << ",\"operations\":" << intervals[index].operations << ",\"throughput\":" << intervals[index].throughput
+               << ",\"elements\":" << intervals[index].elements << ",\"latency\":" << intervals[index].latency.ToJson() << "}";
+
+    stream << "]}\n";
+
+    stream.flags(flags);            // Leave the stream as it was
+    stream.precision(precision);
+}
+
+/**
+ * @brief   Replays the configured workload against a backend.
+ * @param   config  Workload parameters.
+ * @return  Total and per interval measurements.
+ * @throws  std::invalid_argument If the configuration cannot be run.
+ * @throws  std::system_error If a thread cannot be started, the started ones are joined first.
+ */
+template<class BackendType>
+WorkloadReport RunWorkload(const WorkloadConfig& config)
+{
+    if((config.threads == 0) || (config.durationSeconds <= 0) || (config.intervalSeconds <= 0) || (config.keySpace == 0))
+        throw std::invalid_argument("Workload needs threads, a duration, an interval and a key space!");
+
+    const std::vector<double> zipfTable = (config.distribution == KeyDistribution::Zipf)
+                                        ? WorkloadGenerator::BuildZipfTable(config.keySpace, config.zipfSkew)
+                                        : std::vector<double>();
+
+    const size_t intervalCount = static_cast<size_t>(std::ceil(config.durationSeconds / config.intervalSeconds));
+
+    // Recorders are created up front, the threads only look them up
+    LatencyRecorder operationLatencies[workloadOperationCount];
+    std::vector<std::unique_ptr<LatencyRecorder>> intervalLatencies(intervalCount);
+    std::unique_ptr<std::atomic<uint64_t>[]> intervalElements(new std::atomic<uint64_t>[intervalCount]);
+
+    for(size_t index = 0; index < intervalCount; index++)
+    {
+        intervalLatencies[index].reset(new LatencyRecorder());
+        intervalElements[index].store(0, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint64_t> finalElements{0}, findHits{0};
+    std::atomic<size_t> ready{0};
+    std::atomic<bool> go{false}, aborted{false};   // Aborted when not all threads could be started
+    std::chrono::steady_clock::time_point start;
+
+    auto worker = [&](const size_t threadIndex)
+    {
+        WorkloadGenerator generator(config, zipfTable, threadIndex);
+        BackendType backend;
+        std::vector<uint64_t> batch(config.spliceLength);
+        uint64_t hits = 0;
+
+        for(size_t index = 0; index < config.initialSize; index++)
+            backend.Append(generator.NextKey());
+
+        ready.fetch_add(1, std::memory_order_acq_rel);
+        while(go.load(std::memory_order_acquire) == false)
+            std::this_thread::yield();
+
+        if(aborted.load(std::memory_order_relaxed) == true)
+            return;
+
+        const std::chrono::steady_clock::time_point begin = start;
+        const auto duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(config.durationSeconds));
+        const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(config.intervalSeconds));
+        size_t currentInterval = SIZE_MAX;
+
+        for(uint64_t count = 0; (config.operationsPerThread == 0) || (count < config.operationsPerThread); count++)
+        {
+            const WorkloadOperation operation = generator.NextOperation();
+            const uint64_t key = generator.NextKey();
+
+            if(operation == WorkloadOperation::Splice)
+                for(uint64_t& element : batch)
+                    element = generator.NextKey();
+
+            // Keys are drawn and the previous sample is recorded outside of the timed region
+            const std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+
+            switch(operation)
+            {
+            case WorkloadOperation::Append:         backend.Append(key);                            break;
+            case WorkloadOperation::RemoveFirst:    backend.RemoveFirst();                          break;
+            case WorkloadOperation::Find:           hits += (backend.Find(key) == true) ? 1 : 0;    break;
+            case WorkloadOperation::Splice:         backend.Splice(batch);                          break;
+            case WorkloadOperation::Count:                                                          break;
+            }
+
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            if(now - begin >= duration)
+                break;
+
+            const size_t index = std::min(static_cast<size_t>((before - begin) / interval), intervalCount - 1);
+            if(index != currentInterval)
+            {
+                currentInterval = index;
+                intervalElements[currentInterval].fetch_add(backend.GetSize(), std::memory_order_relaxed);
+            }
+
+            const uint64_t nanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - before).count());
+            operationLatencies[static_cast<size_t>(operation)].Record(nanoseconds);
+            intervalLatencies[currentInterval]->Record(nanoseconds);
+        }
+
+        finalElements.fetch_add(backend.GetSize(), std::memory_order_relaxed);
+        findHits.fetch_add(hits, std::memory_order_relaxed);
+    };
+
+    std::vector<std::thread> threads;
+    try
+    {
+        for(size_t index = 0; index < config.threads; index++)
+            threads.emplace_back(worker, index);
+    }
+    catch(...)
+    {
+        // Started threads are released without running the workload, they must be joined before leaving
+        aborted.store(true, std::memory_order_relaxed);
+        go.store(true, std::memory_order_release);
+
+        for(std::thread& thread : threads)
+            thread.join();
+
+        throw;
+    }
+
+    while(ready.load(std::memory_order_acquire) != config.threads)     // Initial fills are not measured
+        std::this_thread::yield();
+
+    start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+
+    for(std::thread& thread : threads)
+        thread.join();
+
+    WorkloadReport report;
+    report.backend          = BackendType::Name();
+    report.config           = config;
+    report.seconds          = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report.finalElements    = finalElements.load(std::memory_order_relaxed);
+    report.findHits         = findHits.load(std::memory_order_relaxed);
+
+    for(size_t index = 0; index < workloadOperationCount; index++)
+    {
+        report.latencies[index]  = operationLatencies[index].GetSummary();
+        report.operations       += report.latencies[index].count;
+    }
+
+    for(size_t index = 0; index < intervalCount; index++)
+    {
+        WorkloadInterval sample;
+        sample.startSeconds = index * config.intervalSeconds;
+        sample.latency      = intervalLatencies[index]->GetSummary();
+        sample.operations   = sample.latency.count;
+        sample.elements     = intervalElements[index].load(std::memory_order_relaxed);
+
+        const double length = std::min(config.intervalSeconds, report.seconds - sample.startSeconds);
+        sample.throughput   = (length > 0) ? sample.operations / length : 0;
+
+        report.intervals.push_back(sample);
+    }
+
+    return report;
+}
+
+} // namespace Benchmark
+
+#endif  // Prevent recursive inclusion
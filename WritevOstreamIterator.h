@@ -0,0 +1,199 @@
+/** @file       WritevOstreamIterator.h
+ *  @details    Zero-copy output iterator for string-like values.
+ *              Instead of copying the strings into a stream buffer, the iterator collects
+ *              iovec entries pointing at the existing string data and at the delimiter,
+ *              then hands them to writev in batches of up to IOV_MAX entries.
+ *  @author     Caglayan DOKME, caglayandokme@gmail.com
+ *  @date       October 18, 2026 -> First release
+ *
+ *  @note       The assigned strings must stay alive and unmodified until the iterator
+ *              is flushed, either by Flush() or by the destruction of its last copy.
+ *              Assigning temporaries is rejected at compile time for this reason.
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright. Code is open source.
+ */
+
+#ifndef WRITEV_OSTREAM_ITERATOR_H
+#define WRITEV_OSTREAM_ITERATOR_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+
+#include <cerrno>
+#include <climits>
+#include <unistd.h>
+#include <sys/uio.h>
+
+/**
+ * @brief   Collects iovec entries and writes them with writev.
+ */
+class IovecBatch{
+public:
+    IovecBatch(const int fileDescriptor, const size_t maxEntries = 0);
+
+    IovecBatch(const IovecBatch&) = delete;
+    IovecBatch& operator=(const IovecBatch&) = delete;
+
+    ~IovecBatch();  // Flushes the remaining entries
+
+    void Add(const void* data, const size_t length);    // Queues a block, flushes if the batch is full
+    void Flush();                                       // Writes all queued blocks
+
+    size_t GetMaxEntries() const    { return maxEntries;        }
+    size_t GetPendingEntries() const{ return entries.size();    }
+    size_t GetWriteCalls() const    { return writeCalls;        }
+
+private:
+    int fileDescriptor  = -1;   // Destination descriptor
+    size_t maxEntries   = 0;    // Entries per writev call
+    size_t writeCalls   = 0;    // Number of writev calls made
+    std::vector<iovec> entries; // Queued blocks
+};
+
+/**
+ * @brief   Constructs an empty batch.
+ * @param   fileDescriptor  Destination descriptor, it is not closed by the batch.
+ * @param   maxEntries      Entries per writev call, zero or larger values select IOV_MAX.
+ * @throws  std::logic_error When the file descriptor is invalid.
+ */
+inline IovecBatch::IovecBatch(const int fileDescriptor, const size_t maxEntries)
+: fileDescriptor(fileDescriptor), maxEntries(maxEntries), writeCalls(0)
+{
+    if(fileDescriptor < 0)
+        throw std::logic_error("Invalid file descriptor!");
+
+    long systemLimit = sysconf(_SC_IOV_MAX);
+    if(systemLimit <= 0)
+        systemLimit = IOV_MAX;
+
+    if((this->maxEntries == 0) || (this->maxEntries > static_cast<size_t>(systemLimit)))
+        this->maxEntries = static_cast<size_t>(systemLimit);
+
+    entries.reserve(this->maxEntries);
+}
+
+/**
+ * @brief   Destructor, flushes the remaining entries.
+ * @note    Errors cannot be reported from a destructor, call Flush() to observe them.
+ */
+inline IovecBatch::~IovecBatch()
+{
+    try         { Flush(); }
+    catch(...)  { /* Nothing to do */ }
+}
+
+/**
+ * @brief   Queues a block of memory.
+ * @param   data    Start of the block, must stay valid until the next flush.
+ * @param   length  Block length, empty blocks are ignored.
+ */
+inline void IovecBatch::Add(const void* data, const size_t length)
+{
+    if(length == 0)
+        return;
+
+    if(entries.size() == maxEntries)
+        Flush();
+
+    entries.push_back(iovec{const_cast<void*>(data), length});
+}
+
+/**
+ * @brief   Writes all queued blocks.
+ * @throws  std::system_error When writev fails.
+ * @note    Partial writes are resumed from the first unwritten byte.
+ */
+inline void IovecBatch::Flush()
+{
+    iovec* current  = entries.data();
+    size_t count    = entries.size();
+
+    while(count > 0)
+    {
+        const ssize_t result = ::writev(fileDescriptor, current, static_cast<int>(count));
+        writeCalls++;
+
+        if(result < 0)
+        {
+            if(errno == EINTR)
+                continue;
+
+            entries.clear();    // Referenced data may be gone after an error
+            throw std::system_error(errno, std::generic_category(), "Writev failed!");
+        }
+
+        // Skip the completely written entries
+        size_t written = static_cast<size_t>(result);
+        while((count > 0) && (written >= current->iov_len))
+        {
+            written -= current->iov_len;
+            current++;
+            count--;
+        }
+
+        // Adjust the partially written entry
+        if(count > 0)
+        {
+            current->iov_base   = static_cast<char*>(current->iov_base) + written;
+            current->iov_len   -= written;
+        }
+    }
+
+    entries.clear();
+}
+
+/**
+ * @brief   Output iterator writing string-like values and a delimiter through writev.
+ * @note    T must be convertible to std::string_view, e.g. std::string or std::string_view.
+ *          Copies of the iterator share the same batch, so the iterator can be passed
+ *          to std::copy by value.
+ */
+template<class T>
+class WritevOstreamIterator{
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+
+    static_assert(std::is_convertible<const T&, std::string_view>::value,
+                  "WritevOstreamIterator requires a string-like value type!");
+
+    WritevOstreamIterator(const int fileDescriptor, const char* delimiter = nullptr, const size_t maxEntries = 0)
+    : delimiter(std::make_shared<const std::string>(delimiter != nullptr ? delimiter : "")),
+      batch(std::make_shared<IovecBatch>(fileDescriptor, maxEntries))
+    { /* Empty constructor */ }
+
+    WritevOstreamIterator& operator=(const T& value)    // Queues the value and the delimiter
+    {
+        const std::string_view text(value);
+
+        batch->Add(text.data(), text.size());
+        batch->Add(delimiter->data(), delimiter->size());   // Refers to the shared copy, no per-element copy
+
+        return *this;
+    }
+
+    WritevOstreamIterator& operator=(const T&& value) = delete; // Temporaries would dangle until the flush
+
+    WritevOstreamIterator& operator*()      { return *this; }   // No-op, as in std::ostream_iterator
+    WritevOstreamIterator& operator++()     { return *this; }   // No-op, as in std::ostream_iterator
+    WritevOstreamIterator& operator++(int)  { return *this; }   // No-op, as in std::ostream_iterator
+
+    void Flush() { batch->Flush(); }    // Writes the queued blocks, after this the strings may be released
+
+    size_t GetWriteCalls() const { return batch->GetWriteCalls(); }
+
+private:
+    // Declared before the batch, so it is destroyed after the final flush of the batch
+    std::shared_ptr<const std::string> delimiter;       // Kept alive until the last copy is gone
+    std::shared_ptr<IovecBatch> batch;                  // Shared between the copies of the iterator
+};
+
+#endif  // Prevent recursive inclusion
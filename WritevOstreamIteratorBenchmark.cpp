@@ -0,0 +1,85 @@
+// Description: Benchmark of WritevOstreamIterator against copying string writers on large log batches
+// Author:      Caglayan DOKME
+// Date:        October 18, 2026 -> First release
+//
+// Build:       g++ -std=c++17 -O2 WritevOstreamIteratorBenchmark.cpp -o WritevOstreamIteratorBenchmark
+// Usage:       ./WritevOstreamIteratorBenchmark [recordCount] [recordLength] [outputPath]
+//              (defaults: 1000000, 200 and /dev/null)
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Benchmark.h"
+#include "FastOstreamIterator.h"
+#include "WritevOstreamIterator.h"
+
+using namespace std;
+
+// Prints a result row with the throughput in MB/s
+static void Report(const string& name, const double seconds, const size_t bytes)
+{
+    cout << setw(36) << left << name << right
+         << setw(10) << fixed << setprecision(4) << seconds << " s"
+         << setw(10) << setprecision(1) << (bytes / seconds) / 1e6 << " MB/s" << endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    const size_t recordCount    = (argc > 1) ? stoull(argv[1]) : 1000000;
+    const size_t recordLength   = (argc > 2) ? stoull(argv[2]) : 200;
+    const char* path            = (argc > 3) ? argv[3] : "/dev/null";
+    const size_t repetitions    = 3;
+
+    // A large log batch, each record is unique to keep the caches honest
+    vector<string> errors(recordCount);
+    size_t bytes = 0;
+    for(size_t index = 0; index < recordCount; index++)
+    {
+        errors[index] = "Error " + to_string(index) + ": ";
+        errors[index].resize(recordLength, 'x');
+        bytes += errors[index].size() + 2;
+    }
+
+    cout << recordCount << " records of " << recordLength << " bytes" << endl;
+
+    const double standard = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        ofstream file(path);
+        copy(errors.begin(), errors.end(), ostream_iterator<string>(file, "\r\n"));
+    });
+    Report("std::ostream_iterator -> ofstream", standard, bytes);
+
+    const double buffered = Benchmark::MeasureBest(repetitions, [&]()
+    {
+        const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        copy(errors.begin(), errors.end(), FastOstreamIterator<string>(fd, "\r\n", 1 << 20));
+        close(fd);
+    });
+    Report("FastOstreamIterator -> fd (1M)", buffered, bytes);
+
+    for(const size_t entries : {64ul, 256ul, 0ul})
+    {
+        size_t writeCalls = 0;
+        const double vectored = Benchmark::MeasureBest(repetitions, [&]()
+        {
+            const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            WritevOstreamIterator<string> errorLog(fd, "\r\n", entries);
+            copy(errors.begin(), errors.end(), errorLog);
+            errorLog.Flush();
+            writeCalls = errorLog.GetWriteCalls();
+            close(fd);
+        });
+        Report("WritevOstreamIterator (" + (entries ? to_string(entries) : string("IOV_MAX")) + " iovecs)", vectored, bytes);
+        cout << "    writev calls: " << writeCalls << endl;
+    }
+
+    return 0;
+}